@@ -136,10 +136,16 @@ export const sourceCodeMap: SourceCodeInfo[] = [
     stepName: "check_unclosed_quotes()",
     files: [
       {
-        path: "/source/lexer/lexer_unclose.c",
-        displayName: "src/lexer/lexer_unclose.c",
-        functions: ["check_unclosed_quotes", "find_matching_quote"],
-        description: "Validate quote pairing before tokenization"
+        path: "/source/lexer/lexer_qmask.c",
+        displayName: "src/lexer/lexer_qmask.c",
+        functions: ["qmask_scan"],
+        description: "Mark every quoted byte of the line in one pass; an open quote is kept for the next line"
+      },
+      {
+        path: "/source/lexer/lexer_line.c",
+        displayName: "src/lexer/lexer_line.c",
+        functions: ["line_load", "line_needs_more", "line_extend"],
+        description: "Ask for another line while a quote or a trailing backslash is still open"
       }
     ]
   },
@@ -166,10 +172,16 @@ export const sourceCodeMap: SourceCodeInfo[] = [
     stepName: "validate_syntax()",
     files: [
       {
-        path: "/source/parser/parser_syntax_check.c",
-        displayName: "src/parser/parser_syntax_check.c",
-        functions: ["validate_syntax", "check_operator_syntax"],
-        description: "Check for syntax errors (invalid operators, unclosed quotes)"
+        path: "/source/parser/parser_pipeline.c",
+        displayName: "src/parser/parser_pipeline.c",
+        functions: ["parser", "parse_pipe_sequence"],
+        description: "Check syntax while the pipeline is built; the offset of the first bad token is reported"
+      },
+      {
+        path: "/source/parser/parser_check_token.c",
+        displayName: "src/parser/parser_check_token.c",
+        functions: ["is_valid_word", "is_control_operator", "is_redirection"],
+        description: "Token classes the syntax rules are written in"
       },
       {
         path: "/source/parser/parser_error.c",
@@ -204,7 +216,7 @@ export const sourceCodeMap: SourceCodeInfo[] = [
       {
         path: "/source/expander/expander_core.c",
         displayName: "src/expander/expander_core.c",
-        functions: ["expander", "expand_variables", "expand_wildcards"],
+        functions: ["expander", "expand_wildcards"],
         description: "Expand variables ($VAR, $?), remove quotes, handle wildcards"
       },
       {
@@ -220,16 +232,22 @@ export const sourceCodeMap: SourceCodeInfo[] = [
     stepName: "executor()",
     files: [
       {
-        path: "/source/executor/executor.c",
-        displayName: "src/executor/executor.c",
-        functions: ["executor", "execute_pipeline", "setup_pipes"],
-        description: "Execute pipeline: setup pipes, fork processes, run commands"
+        path: "/source/executor/executor_pipeline.c",
+        displayName: "src/executor/executor_pipeline.c",
+        functions: ["executor"],
+        description: "Collect heredocs, compile the line into a plan and run it"
+      },
+      {
+        path: "/source/executor/plan_compile.c",
+        displayName: "src/executor/plan_compile.c",
+        functions: ["plan_compile"],
+        description: "Compile each command into flat instructions: redirections, builtins, forks and waits"
       },
       {
-        path: "/source/executor/executor_commands.c",
-        displayName: "src/executor/executor_commands.c",
-        functions: ["execute_command", "setup_redirections"],
-        description: "Execute individual commands with redirections"
+        path: "/source/executor/plan_run.c",
+        displayName: "src/executor/plan_run.c",
+        functions: ["plan_run"],
+        description: "Run the plan one instruction at a time"
       }
     ]
   },
@@ -238,10 +256,10 @@ export const sourceCodeMap: SourceCodeInfo[] = [
     stepName: "Is built-in?",
     files: [
       {
-        path: "/source/executor/executor_commands.c",
-        displayName: "src/executor/executor_commands.c",
-        functions: ["is_builtin", "get_builtin_type"],
-        description: "Check if command is a shell built-in"
+        path: "/source/builtins/builtins.c",
+        displayName: "src/builtins/builtins.c",
+        functions: ["builtin_id", "run_builtin"],
+        description: "Map a command name to its built-in while the plan is compiled"
       }
     ]
   },
@@ -274,16 +292,22 @@ export const sourceCodeMap: SourceCodeInfo[] = [
     stepName: "execute_external()",
     files: [
       {
-        path: "/source/executor/executor_child_run.c",
-        displayName: "src/executor/executor_child_run.c",
-        functions: ["execute_external", "find_executable_path"],
-        description: "Fork child process and execute external command via execve()"
+        path: "/source/executor/plan_emit.c",
+        displayName: "src/executor/plan_emit.c",
+        functions: ["plan_emit_body", "plan_resolve"],
+        description: "Look the program up in PATH through the command hash, in the shell, before the fork"
+      },
+      {
+        path: "/source/executor/plan_ops_spawn.c",
+        displayName: "src/executor/plan_ops_spawn.c",
+        functions: ["op_spawn"],
+        description: "Start a program with posix_spawn() when it needs no forked child"
       },
       {
-        path: "/source/executor/executor_child_fds.c",
-        displayName: "src/executor/executor_child_fds.c",
-        functions: ["setup_child_fds", "dup_file_descriptors"],
-        description: "Setup file descriptors for child process"
+        path: "/source/executor/plan_ops_cmd.c",
+        displayName: "src/executor/plan_ops_cmd.c",
+        functions: ["op_stdio", "op_redir", "op_exec"],
+        description: "In the child: pipe ends and redirections onto stdin/stdout, then execve()"
       }
     ]
   },
@@ -292,10 +316,10 @@ export const sourceCodeMap: SourceCodeInfo[] = [
     stepName: "wait_pipeline()",
     files: [
       {
-        path: "/source/executor/executor.c",
-        displayName: "src/executor/executor.c",
-        functions: ["wait_pipeline", "wait_for_children"],
-        description: "Wait for all child processes to complete"
+        path: "/source/executor/plan_ops.c",
+        displayName: "src/executor/plan_ops.c",
+        functions: ["op_wait"],
+        description: "Reap the pipeline's children as they end; $? comes from their statuses"
       }
     ]
   },
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_ops.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:40:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 11:40:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+#include <time.h>
+
+/*
+** Environment operations on an envp of n variables (30, 1k and 10k by
+** default): init_env() on it, then lookups of keys that are set (hit)
+** and not set (miss), env_set_value() on a key that is set, and an
+** unset followed by the export of the same key. Keys are visited in a
+** scattered order. Best of 5 rounds, in ns per operation. Built by
+** bench/env_ops.sh.
+*/
+
+t_shell		g_shell;
+
+static double	now(void)
+{
+	struct timespec	t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (t.tv_sec + t.tv_nsec * 1e-9);
+}
+
+/* n "VAR_nnnnn=<33 bytes>" strings, or the n keys with pre (e.g. "NOPE") */
+static char	**make_vars(long n, const char *pre, int values)
+{
+	char	**v;
+	long	i;
+
+	v = malloc(sizeof(char *) * (n + 1));
+	if (!v)
+		return (NULL);
+	i = 0;
+	while (i < n)
+	{
+		v[i] = malloc(64);
+		if (!v[i])
+			return (NULL);
+		if (values)
+			sprintf(v[i], "%s_%05ld=v%032ld", pre, i, i);
+		else
+			sprintf(v[i], "%s_%05ld", pre, i);
+		i++;
+	}
+	v[n] = NULL;
+	return (v);
+}
+
+/* op: 0 get, 1 set, 2 unset then export; ns per operation */
+static double	time_op(t_env **env, char **keys, long n, int op)
+{
+	double	best;
+	double	t;
+	long	k;
+	int		r;
+
+	best = 1e9;
+	r = 0;
+	while (r++ < 5)
+	{
+		t = now();
+		k = -1;
+		while (++k < 200000)
+		{
+			if (op == 0 && get_env_value(*env, keys[k * 7919 % n]))
+				g_shell.exit_status++;
+			if (op == 2)
+				remove_env_node(env, keys[k * 7919 % n]);
+			if (op != 0)
+				env_set_value(env, keys[k * 7919 % n], "x");
+		}
+		t = now() - t;
+		if (t < best)
+			best = t;
+	}
+	return (best / 200000 * 1e9);
+}
+
+static void	run_n(long n)
+{
+	char	**envp;
+	char	**hit;
+	char	**miss;
+	t_env	*env;
+	double	t;
+
+	envp = make_vars(n, "VAR", 1);
+	hit = make_vars(n, "VAR", 0);
+	miss = make_vars(n, "NOPE", 0);
+	if (!envp || !hit || !miss)
+	{
+		printf("n=%ld: out of memory\n", n);
+		return ;
+	}
+	t = now();
+	env = init_env(envp);
+	t = now() - t;
+	printf("n=%-6ld init_env %9.3f ms  hit %6.1f ns  miss %6.1f ns",
+		n, t * 1e3, time_op(&env, hit, n, 0), time_op(&env, miss, n, 0));
+	printf("  set %6.1f ns  unset+export %6.1f ns\n",
+		time_op(&env, hit, n, 1), time_op(&env, hit, n, 2));
+	free_env(env);
+}
+
+int	main(int argc, char **argv, char **envp)
+{
+	int	i;
+
+	(void)envp;
+	if (argc == 1)
+	{
+		run_n(30);
+		run_n(1000);
+		run_n(10000);
+	}
+	i = 1;
+	while (i < argc)
+		run_n(atol(argv[i++]));
+	return (0);
+}
@@ -0,0 +1,14 @@
+#!/bin/sh
+# Builds bench/env_ops.c against the objects make left next to the
+# sources (all but main.o) and runs it for each envp size given (30,
+# 1000 and 10000 by default). Run from public/source after make; LIBFT
+# names libft.a.
+#
+#   bench/env_ops.sh [n ...]
+
+LIBFT=${LIBFT:-../libft/libft.a}
+OUT=$(mktemp) || exit 1
+trap 'rm -f "$OUT"' EXIT
+OBJS=$(find . -name '*.o' ! -path ./main/main.o ! -path './bench/*')
+cc -O2 -o "$OUT" bench/env_ops.c $OBJS "$LIBFT" -lreadline || exit 1
+"$OUT" "$@"
@@ -0,0 +1,103 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expand_allocs.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** Arena allocations per line: each line goes through line_take() and
+** process_line() as the shell runs it, and the arena's allocs counter
+** (with its peak bytes) is read before the reset. First with the parse
+** cache off, then on, where the line is run once to fill the cache and
+** counted on the hit. The lines are unset commands, so nothing forks.
+** Built by bench/expand_allocs.sh.
+*/
+
+t_shell		g_shell;
+
+static size_t	count_line(const char *line, size_t *bytes)
+{
+	size_t	n;
+
+	line_take(&g_shell.line, ft_strdup(line));
+	process_line(&g_shell.line, &g_shell);
+	n = g_shell.arena.allocs;
+	*bytes = g_shell.arena.peak;
+	free(g_shell.line.buf);
+	g_shell.line.buf = NULL;
+	arena_reset(&g_shell.arena);
+	return (n);
+}
+
+static void	run_line(const char *name, const char *line)
+{
+	size_t	cap;
+	size_t	off;
+	size_t	on;
+	size_t	off_b;
+	size_t	on_b;
+
+	cap = g_shell.pcache.cap;
+	g_shell.pcache.cap = 0;
+	off = count_line(line, &off_b);
+	g_shell.pcache.cap = cap;
+	on = 0;
+	on_b = 0;
+	if (cap)
+	{
+		count_line(line, &on_b);
+		on = count_line(line, &on_b);
+	}
+	printf("  %-34s off %4zu allocs %7zu B   on %4zu allocs %7zu B\n",
+		name, off, off_b, on, on_b);
+}
+
+/* "unset " and n copies of fmt with the copy's number */
+static char	*gen_line(const char *fmt, int n)
+{
+	char	*line;
+	size_t	len;
+	int		k;
+
+	line = malloc(n * (ft_strlen(fmt) + 8) + 8);
+	if (!line)
+		return (NULL);
+	len = sprintf(line, "unset");
+	k = 0;
+	while (k < n)
+	{
+		len += sprintf(line + len, " ");
+		len += sprintf(line + len, fmt, k);
+		k++;
+	}
+	return (line);
+}
+
+int	main(int argc, char **argv, char **envp)
+{
+	char	*a100;
+	char	*x20;
+
+	(void)argc;
+	(void)argv;
+	init_shell(&g_shell, envp);
+	a100 = gen_line("a%d", 100);
+	x20 = gen_line("\"$X%d\"", 20);
+	if (!a100 || !x20)
+		return (1);
+	run_line("unset a b c d e f g h", "unset a b c d e f g h");
+	run_line("unset \"a\" $HOME x'y' b c", "unset \"a\" $HOME x'y' b c");
+	run_line("unset a0 ... a99", a100);
+	run_line("unset \"$X0\" ... \"$X19\" (empty)", x20);
+	free(a100);
+	free(x20);
+	return (0);
+}
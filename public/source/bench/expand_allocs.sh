@@ -0,0 +1,14 @@
+#!/bin/sh
+# Builds bench/expand_allocs.c against the objects make left next to the
+# sources (all but main.o) and runs it. MINISHELL_PARSE_CACHE in the
+# environment sizes the cache as in the shell. Run from public/source
+# after make; LIBFT names libft.a.
+#
+#   bench/expand_allocs.sh
+
+LIBFT=${LIBFT:-../libft/libft.a}
+OUT=$(mktemp) || exit 1
+trap 'rm -f "$OUT"' EXIT
+OBJS=$(find . -name '*.o' ! -path ./main/main.o ! -path './bench/*')
+cc -O2 -o "$OUT" bench/expand_allocs.c $OBJS "$LIBFT" -lreadline || exit 1
+"$OUT"
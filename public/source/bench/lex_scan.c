@@ -0,0 +1,151 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lex_scan.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 11:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+#include <time.h>
+
+/*
+** Lexer throughput in bytes/sec on one long generated line of
+** compiler-style arguments: classify_block() with each implementation
+** this machine can run, then lexer_resume() over the whole line with
+** and without the qmask_scan() it reads. Best of 5 runs. Built by
+** bench/lex_scan.sh.
+*/
+
+t_shell					g_shell;
+static volatile uint64_t	g_sink;
+
+#if defined(__x86_64__) || defined(__i386__)
+
+static const t_scanner	g_impl[] = {{&classify_scalar}, {&classify_sse2},
+{&classify_avx2}};
+static const char		*g_name[] = {"scalar", "sse2", "avx2"};
+
+#else
+
+static const t_scanner	g_impl[] = {{&classify_scalar}};
+static const char		*g_name[] = {"scalar"};
+
+#endif
+
+static double	now(void)
+{
+	struct timespec	t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (t.tv_sec + t.tv_nsec * 1e-9);
+}
+
+static int	make_line(t_line *ln, size_t size)
+{
+	char	*s;
+	size_t	len;
+	long	k;
+
+	s = malloc(size + 128);
+	if (!s)
+		return (0);
+	len = 0;
+	k = 0;
+	while (len < size)
+	{
+		len += sprintf(s + len, "--define=PKG_%ld=/opt/build/src/module_%ld"
+				"/include/header_%ld.h ", k, k % 97, k);
+		k++;
+	}
+	ft_bzero(ln, sizeof(*ln));
+	return (line_load(ln, s));
+}
+
+/* classify_block() over every block of the line with one implementation */
+static void	run_classify(t_line *ln, int impl)
+{
+	t_cmask	m;
+	size_t	i;
+	double	best;
+	double	t;
+	int		r;
+
+	best = 1e9;
+	r = 0;
+	while (r++ < 5)
+	{
+		t = now();
+		i = 0;
+		while (i < ln->len)
+		{
+			g_impl[impl].classify(ln->buf + i, &m);
+			g_sink ^= m.blank ^ m.op ^ m.sq ^ m.dq ^ m.bs ^ m.dol;
+			i += 64;
+		}
+		t = now() - t;
+		if (t < best)
+			best = t;
+	}
+	printf("  classify %-12s %9.1f MB/s\n", g_name[impl], ln->len / best / 1e6);
+}
+
+/* the whole line lexed again from byte 0, its quote mask too with qm */
+static void	run_lexer(t_line *ln, int qm)
+{
+	double	best;
+	double	t;
+	int		r;
+
+	best = 1e9;
+	r = 0;
+	while (r++ < 5 && best > 0)
+	{
+		ln->tokens.len = 0;
+		t = now();
+		if ((qm && !qmask_scan(ln, 0)) || !lexer_resume(ln, 0))
+			t = -1;
+		else
+			t = now() - t;
+		if (t < best)
+			best = t;
+	}
+	if (best < 0)
+		printf("  lexer failed");
+	else if (qm)
+		printf("  qmask_scan + lexer_resume %6.1f MB/s", ln->len / best / 1e6);
+	else
+		printf("  lexer_resume %19.1f MB/s", ln->len / best / 1e6);
+	printf("  (%zu tokens)\n", ln->tokens.len);
+}
+
+int	main(int argc, char **argv, char **envp)
+{
+	t_line		ln;
+	t_scanner	sc;
+	size_t		mb;
+	int			impl;
+
+	mb = 8;
+	if (argc > 1)
+		mb = atol(argv[1]);
+	init_shell(&g_shell, envp);
+	if (!make_line(&ln, mb << 20))
+		return (1);
+	printf("%zu bytes\n", ln.len);
+	select_scanner(&sc);
+	impl = 0;
+	while (impl < (int)(sizeof(g_impl) / sizeof(*g_impl)))
+	{
+		if (impl < 2 || sc.classify == g_impl[impl].classify)
+			run_classify(&ln, impl);
+		impl++;
+	}
+	run_lexer(&ln, 0);
+	run_lexer(&ln, 1);
+	return (0);
+}
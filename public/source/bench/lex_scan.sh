@@ -0,0 +1,13 @@
+#!/bin/sh
+# Builds bench/lex_scan.c against the objects make left next to the
+# sources (all but main.o) and runs it on a line of MB megabytes (8
+# unless given). Run from public/source after make; LIBFT names libft.a.
+#
+#   bench/lex_scan.sh [MB]
+
+LIBFT=${LIBFT:-../libft/libft.a}
+OUT=$(mktemp) || exit 1
+trap 'rm -f "$OUT"' EXIT
+OBJS=$(find . -name '*.o' ! -path ./main/main.o ! -path './bench/*')
+cc -O2 -o "$OUT" bench/lex_scan.c $OBJS "$LIBFT" -lreadline || exit 1
+"$OUT" "${1:-8}"
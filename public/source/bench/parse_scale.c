@@ -0,0 +1,121 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_scale.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:50:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 09:50:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+#include <time.h>
+
+/*
+** Parser scaling benchmark: parser() alone on lines of 1e3 .. max
+** tokens, the line already lexed, best of a few runs. Each shape is a
+** unit repeated after "cmd " and closed by "end". Linear means the
+** ns/token column stays flat. Built by bench/parse_scale.sh.
+*/
+
+t_shell		g_shell;
+
+static const char	*g_unit[] = {"a | ", "> f ", "a ; ", "a && ", "w "};
+
+static double	now(void)
+{
+	struct timespec	t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (t.tv_sec + t.tv_nsec * 1e-9);
+}
+
+static char	*make_line(int shape, long ntok)
+{
+	char	*line;
+	size_t	ulen;
+	long	k;
+
+	ulen = ft_strlen(g_unit[shape]);
+	line = malloc(ntok * ulen + 16);
+	if (!line)
+		return (NULL);
+	ft_memcpy(line, "cmd ", 4);
+	k = 0;
+	while (k < ntok / (1 + (ulen > 2)))
+	{
+		ft_memcpy(line + 4 + k * ulen, g_unit[shape], ulen);
+		k++;
+	}
+	ft_memcpy(line + 4 + k * ulen, "end", 4);
+	return (line);
+}
+
+/* best time of runs parses of line; tokens gets the token count */
+static double	time_parse(char *line, int runs, size_t *tokens)
+{
+	double	best;
+	double	t;
+	long	off;
+
+	best = 1e9;
+	while (runs-- > 0)
+	{
+		if (!line_load(&g_shell.line, ft_strdup(line)))
+			return (-1);
+		*tokens = g_shell.line.tokens.len;
+		t = now();
+		if (!parser(&g_shell.line.tokens, &off))
+			return (-1);
+		t = now() - t;
+		if (t < best)
+			best = t;
+		free(g_shell.line.buf);
+		g_shell.line.buf = NULL;
+		arena_reset(&g_shell.arena);
+	}
+	return (best);
+}
+
+static void	run_shape(int shape, long max)
+{
+	long	n;
+	char	*line;
+	size_t	tokens;
+	double	t;
+
+	printf("cmd %s...\n", g_unit[shape]);
+	n = 1000;
+	while (n <= max)
+	{
+		line = make_line(shape, n);
+		t = -1;
+		if (line)
+			t = time_parse(line, 3 + 4 * (n < 100000), &tokens);
+		free(line);
+		if (t < 0)
+			printf("  %8ld tokens  failed\n", n);
+		else
+			printf("  %8zu tokens  %9.3f ms  %6.1f ns/token\n",
+				tokens, t * 1e3, t * 1e9 / tokens);
+		n *= 10;
+	}
+}
+
+int	main(int argc, char **argv, char **envp)
+{
+	long	max;
+	int		shape;
+
+	max = 1000000;
+	if (argc > 1)
+		max = atol(argv[1]);
+	init_shell(&g_shell, envp);
+	shape = 0;
+	while (shape < 5)
+		run_shape(shape++, max);
+	arena_destroy(&g_shell.arena);
+	return (0);
+}
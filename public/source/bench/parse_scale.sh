@@ -0,0 +1,13 @@
+#!/bin/sh
+# Builds bench/parse_scale.c against the objects make left next to the
+# sources (all but main.o) and runs it up to max tokens (1e6 unless
+# given). Run from public/source after make; LIBFT names libft.a.
+#
+#   bench/parse_scale.sh [max tokens]
+
+LIBFT=${LIBFT:-../libft/libft.a}
+OUT=$(mktemp) || exit 1
+trap 'rm -f "$OUT"' EXIT
+OBJS=$(find . -name '*.o' ! -path ./main/main.o ! -path './bench/*')
+cc -O2 -o "$OUT" bench/parse_scale.c $OBJS "$LIBFT" -lreadline || exit 1
+"$OUT" "${1:-1000000}"
@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+# Pastes a double-quoted block of n 67-byte lines into the shell on a
+# pty, one line per continuation prompt, as a terminal paste arrives,
+# and times it until the prompt comes back. The block goes through
+# wc -c, so a lost or doubled line shows up in the count (the shell
+# joins continuation lines without a newline).
+#
+#   bench/paste_quoted.py [./minishell] [lines ...]
+
+import os
+import pty
+import re
+import select
+import sys
+import time
+
+LINE = 'x' * 60 + " 'q' |;"
+PS2 = re.compile(rb'[\n\x1b][^\n]*> ')
+
+
+def paste(shell, n):
+    pid, fd = pty.fork()
+    if pid == 0:
+        os.environ['INPUTRC'] = '/dev/null'
+        os.execv(shell, [shell])
+    buf = b''
+
+    def wait(pred, limit):
+        nonlocal buf
+        end = time.time() + limit
+        while not pred():
+            if time.time() > end:
+                raise SystemExit('timeout: ' + repr(buf[-200:]))
+            if select.select([fd], [], [], 0.5)[0]:
+                buf += os.read(fd, 1 << 20)
+
+    wait(lambda: b'minishell>' in buf, 10)
+    buf = b''
+    lines = ['echo "' + LINE] + [LINE] * (n - 2) + [LINE + '" | wc -c']
+    start = time.perf_counter()
+    for k, line in enumerate(lines):
+        os.write(fd, line.encode() + b'\r')
+        if k + 1 < len(lines):
+            wait(lambda: PS2.search(buf), 600)
+            buf = b''
+    wait(lambda: b'minishell>' in buf, 600)
+    took = time.perf_counter() - start
+    os.kill(pid, 9)
+    os.waitpid(pid, 0)
+    got = re.findall(rb'\r(\d+)\r\n', buf)
+    want = n * len(LINE) + 1
+    ok = got and int(got[-1]) == want
+    print('%6d lines  %8.1f KB  %9.2f ms  %s' % (n, n * len(LINE) / 1024,
+          took * 1e3, 'ok' if ok else 'WRONG %s' % got[-1:]))
+
+
+shell = sys.argv[1] if len(sys.argv) > 1 else './minishell'
+for n in [int(a) for a in sys.argv[2:]] or [500, 2000, 8000]:
+    paste(shell, n)
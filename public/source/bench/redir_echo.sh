@@ -0,0 +1,29 @@
+#!/bin/sh
+# 100k redirected echos, run by the shell itself (builtin echo, no fork)
+# and by /bin/echo (a fork and exec per line, the old cost of a builtin
+# with a redirection). Every line has to end up in the log.
+#
+#   bench/redir_echo.sh [./minishell] [lines]
+
+MS=${1:-./minishell}
+N=${2:-100000}
+TMP=$(mktemp -d) || exit 1
+trap 'rm -rf "$TMP"' EXIT
+
+run()
+{
+	awk -v n="$N" -v cmd="$1" -v out="$TMP/log" \
+		'BEGIN { for (i = 0; i < n; i++) print cmd " hello world >> " out }' \
+		> "$TMP/in"
+	rm -f "$TMP/log"
+	start=$(date +%s%N)
+	"$MS" < "$TMP/in" > /dev/null 2>&1
+	end=$(date +%s%N)
+	lines=$(wc -l < "$TMP/log")
+	awk -v c="$1" -v ns=$((end - start)) -v n="$N" -v l="$lines" \
+		'BEGIN { printf "%-10s %8d lines  %9.1f ms  %6.2f us/line  %s\n",
+		c, n, ns / 1e6, ns / 1e3 / n, (l == n) ? "ok" : "LOST " n - l }'
+}
+
+run echo
+run /bin/echo
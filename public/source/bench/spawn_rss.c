@@ -0,0 +1,135 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_rss.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:20:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 11:20:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+#include <time.h>
+
+/*
+** Program start latency against the shell's RSS. For each size the
+** shell grows its heap by that many MB and touches every page, then
+** runs each line LINES times through parse, expand, plan and run, once
+** as compiled (OP_SPAWN) and once with every OP_SPAWN's path cleared,
+** so it falls through to its OP_FORK as it does when spawning fails.
+** Best of 3 rounds, in microseconds per line. Built by
+** bench/spawn_rss.sh.
+*/
+
+t_shell				g_shell;
+static const char	*g_lines[] = {"/bin/true", "true | cat | true"};
+
+static double	now(void)
+{
+	struct timespec	t;
+
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (t.tv_sec + t.tv_nsec * 1e-9);
+}
+
+/* one line, start to finish; forked drops the spawns from the plan */
+static int	run_line(const char *line, int forked)
+{
+	t_pipeline	*pl;
+	t_plan		*plan;
+	long		off;
+	int			i;
+
+	plan = NULL;
+	pl = NULL;
+	if (line_load(&g_shell.line, ft_strdup(line)))
+		pl = parser(&g_shell.line.tokens, &off);
+	if (pl)
+		expand_pipeline_cmds(pl->cmds, g_shell.env, g_shell.exit_status);
+	if (pl)
+		plan = plan_compile(pl->cmds);
+	i = -1;
+	while (plan && ++i < plan->len)
+		if (forked && plan->code[i].op == OP_SPAWN)
+			plan->code[i].path = NULL;
+	if (plan)
+		plan_run(plan, &g_shell);
+	free(g_shell.line.buf);
+	g_shell.line.buf = NULL;
+	arena_reset(&g_shell.arena);
+	return (plan != NULL);
+}
+
+/* best of 3 rounds of LINES runs, in microseconds per line */
+static double	time_line(const char *line, int forked, int lines)
+{
+	double	best;
+	double	t;
+	int		r;
+	int		k;
+
+	best = 1e9;
+	r = 0;
+	while (r++ < 3)
+	{
+		t = now();
+		k = 0;
+		while (k++ < lines)
+			if (!run_line(line, forked))
+				return (-1);
+		t = now() - t;
+		if (t < best)
+			best = t;
+	}
+	return (best / lines * 1e6);
+}
+
+static void	run_size(long mb, int lines)
+{
+	char	*ballast;
+	int		i;
+
+	ballast = malloc((size_t)mb << 20);
+	if (mb && !ballast)
+	{
+		printf("RSS +%ld MB: out of memory\n", mb);
+		return ;
+	}
+	ft_memset(ballast, 1, (size_t)mb << 20);
+	i = 0;
+	while (i < 2)
+	{
+		printf("RSS +%-5ld MB  %-18s  spawn %8.0f us  fork %8.0f us\n",
+			mb, g_lines[i], time_line(g_lines[i], 0, lines),
+			time_line(g_lines[i], 1, lines));
+		i++;
+	}
+	free(ballast);
+}
+
+int	main(int argc, char **argv, char **envp)
+{
+	int		i;
+	int		lines;
+	char	*sizes[5];
+
+	init_shell(&g_shell, envp);
+	lines = 300;
+	if (getenv("LINES_PER_ROUND"))
+		lines = atoi(getenv("LINES_PER_ROUND"));
+	sizes[0] = "0";
+	sizes[1] = "100";
+	sizes[2] = "500";
+	sizes[3] = "2000";
+	sizes[4] = NULL;
+	if (argc > 1)
+		argv++;
+	else
+		argv = sizes;
+	i = 0;
+	while (argv[i])
+		run_size(atol(argv[i++]), lines);
+	return (0);
+}
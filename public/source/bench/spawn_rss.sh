@@ -0,0 +1,14 @@
+#!/bin/sh
+# Builds bench/spawn_rss.c against the objects make left next to the
+# sources (all but main.o) and runs it for each RSS growth given in MB
+# (0 100 500 2000 by default). LINES_PER_ROUND sets the lines per
+# round (300). Run from public/source after make; LIBFT names libft.a.
+#
+#   bench/spawn_rss.sh [MB ...]
+
+LIBFT=${LIBFT:-../libft/libft.a}
+OUT=$(mktemp) || exit 1
+trap 'rm -f "$OUT"' EXIT
+OBJS=$(find . -name '*.o' ! -path ./main/main.o ! -path './bench/*')
+cc -O2 -o "$OUT" bench/spawn_rss.c $OBJS "$LIBFT" -lreadline || exit 1
+"$OUT" "$@"
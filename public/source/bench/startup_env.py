@@ -0,0 +1,28 @@
+#!/usr/bin/env python3
+# Startup latency with a large environment: the shell runs with nothing
+# but n generated variables (as under env -i), 33-byte values, and
+# empty stdin, so the time is startup plus exit. Best of 7 runs; n = 0
+# is the floor.
+#
+#   bench/startup_env.py [./minishell] [n ...]
+
+import subprocess
+import sys
+import time
+
+
+def startup(shell, n):
+    env = {'VAR_%05d' % i: ('v%032d' % i)[:33] for i in range(n)}
+    best = None
+    for _ in range(7):
+        start = time.perf_counter()
+        subprocess.run([shell], env=env, stdin=subprocess.DEVNULL,
+                       stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        took = time.perf_counter() - start
+        best = took if best is None else min(best, took)
+    print('  n=%-6d %8.2f ms' % (n, best * 1e3))
+
+
+shell = sys.argv[1] if len(sys.argv) > 1 else './minishell'
+for n in [int(a) for a in sys.argv[2:]] or [0, 5000, 10000, 20000]:
+    startup(shell, n)
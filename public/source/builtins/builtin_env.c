@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/03 11:55:37 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 19:38:20 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,15 +19,20 @@
 */
 int	builtin_env(t_env *env)
 {
-	while (env)
+	t_var	*var;
+
+	var = NULL;
+	if (env)
+		var = env->head;
+	while (var)
 	{
-		if (env->value)
+		if (var->value)
 		{
-			ft_putstr_fd(env->key, 1);
+			ft_putstr_fd(var->key, 1);
 			ft_putstr_fd("=", 1);
-			ft_putendl_fd(env->value, 1);
+			ft_putendl_fd(var->value, 1);
 		}
-		env = env->next;
+		var = var->next;
 	}
 	return (0);
 }
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_set.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:05:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 01:05:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/* set -o lists the options as bash does, set +o as commands */
+static void	set_list(t_shell *shell, int plus)
+{
+	if (plus)
+	{
+		ft_putstr_fd("set ", 1);
+		if (shell->pipefail)
+			ft_putendl_fd("-o pipefail", 1);
+		else
+			ft_putendl_fd("+o pipefail", 1);
+		return ;
+	}
+	ft_putstr_fd("pipefail       \t", 1);
+	if (shell->pipefail)
+		ft_putendl_fd("on", 1);
+	else
+		ft_putendl_fd("off", 1);
+}
+
+/*
+** set [-o|+o] [option]: -o turns an option on, +o off; pipefail is
+** the only one there is. Positional parameters and the one-letter
+** options are not supported.
+*/
+int	builtin_set(char **args, t_shell *shell)
+{
+	int	plus;
+
+	if (!args[1])
+		return (0);
+	plus = args[1][0] == '+';
+	if (ft_strcmp(args[1], "-o") != 0 && ft_strcmp(args[1], "+o") != 0)
+	{
+		print_error("set", "usage: set [-o|+o] [option]");
+		return (2);
+	}
+	if (!args[2])
+	{
+		set_list(shell, plus);
+		return (0);
+	}
+	if (ft_strcmp(args[2], "pipefail") != 0 || args[3])
+	{
+		ft_putstr_fd("minishell: set: ", 2);
+		ft_putstr_fd(args[2], 2);
+		ft_putendl_fd(": invalid option name", 2);
+		return (1);
+	}
+	shell->pipefail = !plus;
+	return (0);
+}
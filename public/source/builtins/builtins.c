@@ -6,60 +6,73 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/05 11:21:11 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/18 09:10:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
 /*
-** Check if a command is a built-in
-** Returns 1 if builtin, 0 otherwise
+** Which builtin name is, BI_NONE for anything else
 */
-int	is_builtin(char *cmd)
+t_builtin	builtin_id(const char *name)
 {
-	if (ft_strcmp(cmd, "echo") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "cd") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "pwd") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "export") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "unset") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "env") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "exit") == 0)
-		return (1);
-	if (!ft_strcmp(cmd, "history"))
-		return (1);
-	return (0);
+	if (ft_strcmp(name, "echo") == 0)
+		return (BI_ECHO);
+	if (ft_strcmp(name, "cd") == 0)
+		return (BI_CD);
+	if (ft_strcmp(name, "pwd") == 0)
+		return (BI_PWD);
+	if (ft_strcmp(name, "export") == 0)
+		return (BI_EXPORT);
+	if (ft_strcmp(name, "unset") == 0)
+		return (BI_UNSET);
+	if (ft_strcmp(name, "env") == 0)
+		return (BI_ENV);
+	if (ft_strcmp(name, "exit") == 0)
+		return (BI_EXIT);
+	if (ft_strcmp(name, "history") == 0)
+		return (BI_HISTORY);
+	if (ft_strcmp(name, "hash") == 0)
+		return (BI_HASH);
+	if (ft_strcmp(name, "set") == 0)
+		return (BI_SET);
+	if (ft_strcmp(name, "stages") == 0)
+		return (BI_STAGES);
+	if (ft_strcmp(name, "pcache") == 0)
+		return (BI_PCACHE);
+	return (BI_NONE);
 }
 
 /*
 ** Execute a built-in command
-** Dispatches to the appropriate builtin function
+** Dispatches on the id builtin_id() gave for args[0]
 */
-int	execute_builtin(t_cmd *cmd, t_shell *shell)
+int	run_builtin(t_builtin id, char **args, t_shell *shell)
 {
-	if (!cmd || !cmd->args || !cmd->args[0])
-		return (0);
-	if (ft_strcmp(cmd->args[0], "echo") == 0)
-		return (builtin_echo(cmd->args));
-	if (ft_strcmp(cmd->args[0], "cd") == 0)
-		return (builtin_cd(cmd->args, &shell->env));
-	if (ft_strcmp(cmd->args[0], "pwd") == 0)
+	if (id == BI_ECHO)
+		return (builtin_echo(args));
+	if (id == BI_CD)
+		return (builtin_cd(args, &shell->env));
+	if (id == BI_PWD)
 		return (builtin_pwd());
-	if (ft_strcmp(cmd->args[0], "export") == 0)
-		return (builtin_export(cmd->args, &shell->env));
-	if (ft_strcmp(cmd->args[0], "unset") == 0)
-		return (builtin_unset(cmd->args, &shell->env));
-	if (ft_strcmp(cmd->args[0], "env") == 0)
+	if (id == BI_EXPORT)
+		return (builtin_export(args, &shell->env));
+	if (id == BI_UNSET)
+		return (builtin_unset(args, &shell->env));
+	if (id == BI_ENV)
 		return (builtin_env(shell->env));
-	if (ft_strcmp(cmd->args[0], "exit") == 0)
-		return (builtin_exit(cmd->args, shell));
-	if (ft_strcmp(cmd->args[0], "history") == 0)
-		return (builtin_history(cmd->args));
+	if (id == BI_EXIT)
+		return (builtin_exit(args, shell));
+	if (id == BI_HISTORY)
+		return (builtin_history(args));
+	if (id == BI_HASH)
+		return (builtin_hash(args, shell));
+	if (id == BI_SET)
+		return (builtin_set(args, shell));
+	if (id == BI_STAGES)
+		return (builtin_stages(args, shell));
+	if (id == BI_PCACHE)
+		return (builtin_pcache(args, shell));
 	return (0);
 }
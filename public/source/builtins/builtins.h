@@ -1,40 +1,40 @@
 /* ************************************************************************** */
 /*                                                                            */
 /*                                                        :::      ::::::::   */
-/*   executor_commands_utils.c                          :+:      :+:    :+:   */
+/*   builtins.h                                         :+:      :+:    :+:   */
 /*                                                    +:+ +:+         +:+     */
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/11/23 00:00:00 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/23 00:00:00 by malmarzo         ###   ########.fr       */
+/*   Created: 2026/10/17 17:48:26 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 09:10:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "../../minishell.h"
+#ifndef BUILTINS_H
+# define BUILTINS_H
 
-void	perror_with_cmd(const char *cmd)
+/*
+** Builtins are looked up by name once, when the execution plan is
+** compiled, and dispatched by id from then on.
+*/
+typedef enum e_builtin
 {
-	if (!cmd)
-		return ;
-	write(2, "minishell: ", 11);
-	write(2, cmd, ft_strlen(cmd));
-	write(2, ": ", 2);
-	write(2, strerror(errno), ft_strlen(strerror(errno)));
-	write(2, "\n", 1);
-}
+	BI_NONE = -1,
+	BI_ECHO,
+	BI_CD,
+	BI_PWD,
+	BI_EXPORT,
+	BI_UNSET,
+	BI_ENV,
+	BI_EXIT,
+	BI_HISTORY,
+	BI_HASH,
+	BI_SET,
+	BI_STAGES,
+	BI_PCACHE
+}	t_builtin;
 
-int	has_slash(const char *s)
-{
-	int	i;
+t_builtin	builtin_id(const char *name);
+int			run_builtin(t_builtin id, char **args, t_shell *shell);
 
-	if (!s)
-		return (0);
-	i = 0;
-	while (s[i] != '\0')
-	{
-		if (s[i] == '/')
-			return (1);
-		i++;
-	}
-	return (0);
-}
+#endif
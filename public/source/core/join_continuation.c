@@ -6,23 +6,16 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/03 11:55:37 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 15:40:12 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
 /* ************************************************************************** */
-/*                         1. SAFE STRING JOIN                                */
+/*                         1. HELPERS                                         */
 /* ************************************************************************** */
 
-static size_t	get_safe_len(const char *s)
-{
-	if (s)
-		return (ft_strlen(s));
-	return (0);
-}
-
 static void	copy_str(char *dst, const char *src, size_t len)
 {
 	size_t	i;
@@ -35,67 +28,28 @@ static void	copy_str(char *dst, const char *src, size_t len)
 	}
 }
 
-static char	*str_join(const char *a, const char *b)
-{
-	size_t	la;
-	size_t	lb;
-	char	*r;
-
-	la = get_safe_len(a);
-	lb = get_safe_len(b);
-	r = malloc(la + lb + 1);
-	if (!r)
-		return (NULL);
-	if (a)
-		copy_str(r, a, la);
-	if (b)
-		copy_str(r + la, b, lb);
-	r[la + lb] = '\0';
-	return (r);
-}
-
-/* ************************************************************************** */
-/*                         2. REMOVE "\\<newline>" LOGIC                      */
-/* ************************************************************************** */
-
-static void	remove_continuation_backslash(char *line)
-{
-	int	i;
-	int	last;
-	int	count;
-
-	if (!line)
-		return ;
-	i = (int)ft_strlen(line) - 1;
-	while (i >= 0 && (line[i] == ' ' || line[i] == '\t'))
-		i--;
-	last = i;
-	count = 0;
-	while (i >= 0 && line[i] == '\\')
-	{
-		count++;
-		i--;
-	}
-	if (count % 2 == 1 && last >= 0)
-		line[last] = '\0';
-}
-
 /* ************************************************************************** */
-/*                         3. MAIN PUBLIC FUNCTION                            */
+/*                         2. MAIN PUBLIC FUNCTION                            */
 /* ************************************************************************** */
 
-char	*join_continuation(char *line, char *next)
+/*
+** Append next to the logical line in place. The scan of ln already
+** knows whether the line ends in a continuation backslash; when it does,
+** that backslash is the last byte and is cut. line_reserve() doubles
+** the buffer and keeps the scan padding behind the new end.
+*/
+int	join_continuation(t_line *ln, char *next)
 {
-	char	*r;
+	size_t	len;
 
-	if (!line && !next)
-		return (NULL);
-	if (!line)
-		return (ft_strdup(next));
-	remove_continuation_backslash(line);
+	if (ln->esc && ln->len > 0)
+		ln->buf[--ln->len] = '\0';
 	while (*next == ' ' || *next == '\t' || *next == '\n')
 		next++;
-	r = str_join(line, next);
-	free(line);
-	return (r);
+	len = ft_strlen(next);
+	if (!line_reserve(ln, ln->len + len + 1))
+		return (0);
+	copy_str(ln->buf + ln->len, next, len + 1);
+	ln->len += len;
+	return (1);
 }
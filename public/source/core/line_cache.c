@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   line_cache.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:02:44 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 09:10:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** Give ln the line cached in e: its buffer as the parser left it and
+** its quote mask, which the expander and the heredoc code read. src
+** is only freed once that worked.
+*/
+static int	line_from_cache(t_line *ln, t_pcent *e, char *src)
+{
+	ln->buf = NULL;
+	ln->cap = 0;
+	if (!line_reserve(ln, e->len + 1))
+		return (0);
+	ft_memcpy(ln->buf, e->image, e->len + 1);
+	free(src);
+	ln->len = e->len;
+	ln->quote = 0;
+	ln->esc = 0;
+	ln->joined = 0;
+	ft_bzero(&ln->tokens, sizeof(ln->tokens));
+	ft_bzero(&ln->qm, sizeof(ln->qm));
+	ln->qm.stop = e->stop;
+	ln->qm.dol = e->dol;
+	ln->qm.drop = e->drop;
+	return (1);
+}
+
+/*
+** Take src (malloc'd, from readline) as the next line. A line seen
+** before comes out of the parse cache, complete, and is neither
+** scanned nor lexed; anything else goes through line_load().
+*/
+char	*line_take(t_line *ln, char *src)
+{
+	t_pcache	*pc;
+	size_t		len;
+
+	pc = &g_shell.pcache;
+	pc->hit = NULL;
+	if (pc->cap && *src)
+	{
+		len = ft_strlen(src);
+		pc->hash = pcache_hash(src, len);
+		pc->hit = pcache_lookup(pc, src, len);
+	}
+	if (pc->hit && line_from_cache(ln, pc->hit, src))
+		return (ln->buf);
+	pc->hit = NULL;
+	line_load(ln, src);
+	return (ln->buf);
+}
+
+/*
+** The line as it was typed, for the history: a buffer that came from
+** the cache has a NUL after every word, its text is the entry's key.
+*/
+char	*line_text(t_line *ln)
+{
+	if (g_shell.pcache.hit)
+		return (g_shell.pcache.hit->key);
+	return (ln->buf);
+}
+
+/*
+** The tree for a complete line: a fresh copy of the cached one on a
+** hit, else the parser's, which is cached when the line was typed as a
+** single physical line (the cache is keyed by what readline returns).
+*/
+t_pipeline	*line_parse(t_line *ln, long *err_off)
+{
+	t_pcache	*pc;
+	t_pipeline	*tree;
+	char		*mem;
+	char		*key;
+
+	pc = &g_shell.pcache;
+	*err_off = -1;
+	if (pc->hit)
+	{
+		mem = arena_alloc(&g_shell.arena, pc->hit->tree_size);
+		if (!mem)
+			return (NULL);
+		return (pcache_copy(pc->hit->tree, mem, pc->hit->image, ln->buf));
+	}
+	key = NULL;
+	if (pc->cap && !ln->joined)
+		key = arena_strndup(&g_shell.arena, ln->buf, ln->len);
+	tree = parser(&ln->tokens, err_off);
+	if (tree && key)
+		pcache_store(pc, key, ln, tree);
+	return (tree);
+}
@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/20 21:00:00 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 17:20:15 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -36,15 +36,26 @@ static char	*read_one_line(const char *prompt)
 /*                     3.  FULL BASH-LIKE LOGICAL LINE READER                 */
 /* ************************************************************************** */
 
-static char	*handle_continuation_error(char *line)
+static int	handle_continuation_error(t_line *ln)
 {
-	free(line);
+	char	*empty;
+
+	free(ln->buf);
 	ft_putendl_fd("minishell: syntax error: unexpected end of file", 2);
 	g_shell.exit_status = 258;
-	return (ft_strdup(""));
+	empty = ft_strdup("");
+	if (!empty)
+		return (0);
+	line_load(ln, empty);
+	return (1);
 }
 
-static char	*process_continuation(char *line)
+/*
+** Returns 0 when the line is gone (Ctrl-C), 1 otherwise. Only the
+** appended text is lexed, see line_extend(); if that fails the line is
+** left with no tokens and nothing runs.
+*/
+static int	process_continuation(t_line *ln)
 {
 	char	*more;
 
@@ -53,32 +64,36 @@ static char	*process_continuation(char *line)
 	g_shell.in_continuation = 0;
 	if (g_shell.sigint_during_read)
 	{
-		free(line);
+		free(ln->buf);
+		ln->buf = NULL;
 		if (more)
 			free(more);
-		return (NULL);
+		return (0);
 	}
 	if (!more)
-		return (handle_continuation_error(line));
-	line = join_continuation(line, more);
+		return (handle_continuation_error(ln));
+	line_extend(ln, more);
 	free(more);
-	return (line);
+	return (1);
 }
 
-char	*read_logical_line(void)
+/*
+** The first physical line is scanned into ln, unless the parse cache
+** already has it; every continuation is appended to the same buffer
+** and only the new bytes are scanned.
+*/
+char	*read_logical_line(t_line *ln)
 {
 	char	*line;
 
 	line = read_one_line("\001\033[1;33m\002minishell> \001\033[0m\002");
 	if (!line)
 		return (NULL);
-	while (needs_continuation(line))
+	line_take(ln, line);
+	while (line_needs_more(ln))
 	{
-		line = process_continuation(line);
-		if (!line)
+		if (!process_continuation(ln))
 			return (NULL);
-		if (!*line && g_shell.exit_status == 258)
-			return (line);
 	}
-	return (line);
+	return (ln->buf);
 }
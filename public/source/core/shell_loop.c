@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/13 15:04:45 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/18 09:10:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -28,6 +28,24 @@ static int	handle_eof_and_sigint(t_shell *shell, char *line)
 	return (0);
 }
 
+static char	*read_line(t_shell *shell, t_line *ln)
+{
+	char	*line;
+
+	if (shell->interactive)
+		return (read_logical_line(ln));
+	line = readline("");
+	if (!line)
+		return (NULL);
+	return (line_take(ln, line));
+}
+
+/*
+** The line's tokens, commands and expanded words all come from
+** shell->arena, so everything the line allocated goes with one
+** arena_reset() once it has run. The line lives in shell->line while
+** it runs, so later stages can look up its quote mask by offset.
+*/
 void	shell_loop(t_shell *shell)
 {
 	char	*line;
@@ -37,10 +55,7 @@ void	shell_loop(t_shell *shell)
 	{
 		if (!g_shell.in_heredoc)
 			setup_signals();
-		if (shell->interactive)
-			line = read_logical_line();
-		else
-			line = readline("");
+		line = read_line(shell, &shell->line);
 		status = handle_eof_and_sigint(shell, line);
 		if (status == 1)
 			continue ;
@@ -49,9 +64,11 @@ void	shell_loop(t_shell *shell)
 		if (*line && !is_all_space(line))
 		{
 			if (shell->interactive)
-				history_add_line(line);
-			process_line(line, shell);
+				history_add_line(line_text(&shell->line));
+			process_line(&shell->line, shell);
 		}
 		free(line);
+		shell->line.buf = NULL;
+		arena_reset(&shell->arena);
 	}
 }
@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/13 15:04:45 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/18 12:20:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -26,59 +26,35 @@ int	is_all_space(const char *s)
 	return (1);
 }
 
-static int	check_unclosed_quotes(char *line)
-{
-	if (has_unclosed_quotes(line))
-	{
-		ft_putendl_fd("minishell: syntax error: unclosed quotes", 2);
-		return (0);
-	}
-	return (1);
-}
-
 /*
-** NEW: Do not parse an incomplete logical line.
-** Bash never performs syntax checks mid-continuation.
+** Everything below works on the tokens the reader already cut. An
+** incomplete logical line is not parsed: bash never performs syntax
+** checks mid-continuation. The parser checks the syntax as it goes and
+** reports where it stopped. A line from the parse cache has no tokens
+** and needs none.
 */
-static int	is_incomplete_logical_line(char *line)
-{
-	if (needs_continuation(line))
-		return (1);
-	return (0);
-}
-
-static int	process_tokens(char *line, t_pipeline **pipeline)
+static int	process_tokens(t_line *ln, t_pipeline **pipeline)
 {
-	t_token	*tokens;
+	long	err_off;
 
-	if (is_incomplete_logical_line(line))
-		return (0);
-	if (!check_unclosed_quotes(line))
-		return (0);
-	tokens = lexer(line);
-	if (!tokens)
+	if (!g_shell.pcache.hit
+		&& (line_needs_more(ln) || ln->tokens.len == 0))
 		return (0);
-	if (!validate_syntax(tokens, &g_shell))
-	{
-		free_tokens(tokens);
-		return (0);
-	}
-	*pipeline = parser(tokens);
-	free_tokens(tokens);
+	*pipeline = line_parse(ln, &err_off);
+	if (!*pipeline && err_off >= 0)
+		print_syntax_offset(ln, err_off);
 	return (*pipeline != NULL);
 }
 
-void	process_line(char *line, t_shell *shell)
+void	process_line(t_line *ln, t_shell *shell)
 {
 	t_pipeline	*pipeline;
 
-	if (!line || !*line)
-		return ;
-	if (needs_continuation(line))
+	if (!ln->buf || !*ln->buf)
 		return ;
-	if (!process_tokens(line, &pipeline))
+	if (!process_tokens(ln, &pipeline))
 		return ;
-	expander(pipeline, shell->env);
-	executor(pipeline, shell);
-	free_pipeline(pipeline);
+	if (heredoc_collect(pipeline) == 0)
+		executor(pipeline, shell);
+	heredoc_close(pipeline);
 }
@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/12 14:31:55 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 20:15:30 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -18,59 +18,60 @@
 ** SHLVL tracks the nesting level of shells. Each time a new shell
 ** is started, SHLVL should be incremented by 1.
 **
-** @param env: Pointer to environment linked list
+** @param env: Pointer to the environment
 **
 ** Return: void
 */
 void	increment_shlvl(t_env **env)
 {
-	t_env	*current;
+	t_var	*current;
 	int		shlvl_value;
 
-	current = *env;
-	while (current)
+	current = env_find(*env, "SHLVL");
+	if (!current)
 	{
-		if (ft_strcmp(current->key, "SHLVL") == 0)
-		{
-			shlvl_value = ft_atoi(current->value);
-			if (shlvl_value < 0)
-				shlvl_value = 0;
-			shlvl_value++;
-			free(current->value);
-			current->value = ft_itoa(shlvl_value);
-			return ;
-		}
-		current = current->next;
+		add_env_node(env, create_env_node("SHLVL", "1"));
+		return ;
 	}
-	add_env_node(env, create_env_node("SHLVL", "1"));
+	shlvl_value = 0;
+	if (current->value)
+		shlvl_value = ft_atoi(current->value);
+	if (shlvl_value < 0)
+		shlvl_value = 0;
+	shlvl_value++;
+	env_drop_value(current);
+	current->value = ft_itoa(shlvl_value);
+	(*env)->gen++;
 }
 
 /*
 ** Initialize environment from envp array
-** Creates linked list of environment variables
+** Variables keep envp's order. The index is sized for all of envp up
+** front and each variable is read straight into its one allocation
 */
 t_env	*init_env(char **envp)
 {
 	t_env	*env;
-	int		i;
-	char	*key;
-	char	*value;
-	char	*eq_pos;
+	t_var	*var;
+	char	*eq;
+	size_t	n;
 
-	env = NULL;
-	i = 0;
-	while (envp[i])
+	env = env_new();
+	n = 0;
+	while (envp[n])
+		n++;
+	if (!env || !env_reserve(env, n))
+		return (env);
+	while (*envp)
 	{
-		eq_pos = ft_strchr(envp[i], '=');
-		if (eq_pos)
+		eq = ft_strchr(*envp, '=');
+		if (eq)
 		{
-			key = ft_substr(envp[i], 0, eq_pos - envp[i]);
-			value = ft_strdup(eq_pos + 1);
-			add_env_node(&env, create_env_node(key, value));
-			free(key);
-			free(value);
+			var = env_var_new(*envp, eq - *envp, eq + 1);
+			if (var && !env_link(env, var))
+				env_free_var(var);
 		}
-		i++;
+		envp++;
 	}
 	return (env);
 }
@@ -81,6 +82,7 @@ void	init_shell(t_shell *shell, char **envp)
 	if (isatty(STDIN_FILENO))
 		shell->interactive = 1;
 	shell->env = init_env(envp);
+	pcache_init(&shell->pcache, shell->env);
 	shell->exit_status = 0;
 	shell->should_exit = 0;
 	rl_catch_signals = 0;
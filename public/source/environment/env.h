@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env.h                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:20:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 20:15:30 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ENV_H
+# define ENV_H
+
+# include <stddef.h>
+# include <stdint.h>
+
+/*
+** The environment: its variables in the order they were first set,
+** which is the order env and export print them in, plus an
+** open-addressing index over them. The index probes linearly and is
+** never more than half full, so a lookup costs one hash and usually a
+** single key compare, whatever the number of variables. Removing a
+** variable shifts the rest of its probe run back, so there are no
+** tombstones to skip or to clean up.
+**
+** slots has cap entries (0 or a power of two); a NULL slot ends a run.
+**
+** A variable is one allocation: the t_var, then its name and, until it
+** is first changed, its value. env_drop_value() knows not to free a
+** value that lives there.
+**
+** envp is the KEY=VALUE array handed to execve(), built by env_envp()
+** only when gen (bumped by every change to a name or a value) has moved
+** past envp_gen. The shell builds it before it forks, so children share
+** the parent's copy instead of each making and leaking one.
+*/
+# define ENV_INIT	64
+
+typedef struct s_var
+{
+	char			*key;
+	char			*value;
+	uint64_t		hash;
+	struct s_var	*prev;
+	struct s_var	*next;
+}	t_var;
+
+typedef struct s_env
+{
+	t_var	**slots;
+	size_t	cap;
+	size_t	count;
+	t_var	*head;
+	t_var	*tail;
+	char	**envp;
+	size_t	gen;
+	size_t	envp_gen;
+}	t_env;
+
+t_env		*env_new(void);
+uint64_t	env_hash(const char *key);
+t_var		*env_find(t_env *env, const char *key);
+int			env_reserve(t_env *env, size_t n);
+int			env_link(t_env *env, t_var *var);
+void		env_unlink(t_env *env, t_var *var);
+t_var		*env_var_new(const char *key, size_t klen, const char *value);
+void		env_drop_value(t_var *var);
+void		env_free_var(t_var *var);
+char		**env_envp(t_env *env);
+
+#endif
@@ -0,0 +1,99 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_envp.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:50:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 19:58:40 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/* how many variables have a value, and the bytes of their KEY=VALUE */
+static size_t	envp_size(t_var *var, size_t *n)
+{
+	size_t	bytes;
+
+	*n = 0;
+	bytes = 0;
+	while (var)
+	{
+		if (var->value)
+		{
+			(*n)++;
+			bytes += ft_strlen(var->key) + ft_strlen(var->value) + 2;
+		}
+		var = var->next;
+	}
+	return (bytes);
+}
+
+static char	*put_pair(char *p, t_var *var)
+{
+	size_t	len;
+
+	len = ft_strlen(var->key);
+	ft_memcpy(p, var->key, len);
+	p[len++] = '=';
+	p += len;
+	len = ft_strlen(var->value) + 1;
+	ft_memcpy(p, var->value, len);
+	return (p + len);
+}
+
+/*
+** Convert environment to array
+** Creates the KEY=VALUE array for execve in one block, the pointers
+** followed by the strings, so a single free() releases it
+*/
+char	**env_to_array(t_env *env)
+{
+	char	**envp;
+	char	*p;
+	t_var	*var;
+	size_t	n;
+	size_t	bytes;
+
+	var = env->head;
+	bytes = envp_size(var, &n);
+	envp = malloc((n + 1) * sizeof(char *) + bytes);
+	if (!envp)
+		return (NULL);
+	p = (char *)(envp + n + 1);
+	n = 0;
+	while (var)
+	{
+		if (var->value)
+		{
+			envp[n++] = p;
+			p = put_pair(p, var);
+		}
+		var = var->next;
+	}
+	envp[n] = NULL;
+	return (envp);
+}
+
+/*
+** The environment as execve() wants it. The array is rebuilt only when
+** something changed since it was last built; it belongs to env.
+*/
+char	**env_envp(t_env *env)
+{
+	char	**envp;
+
+	if (!env)
+		return (NULL);
+	if (env->envp && env->envp_gen == env->gen)
+		return (env->envp);
+	envp = env_to_array(env);
+	if (!envp)
+		return (NULL);
+	free(env->envp);
+	env->envp = envp;
+	env->envp_gen = env->gen;
+	return (envp);
+}
@@ -6,76 +6,74 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/06 15:02:18 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 20:15:30 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
 /*
-** Create a new environment variable node
-** Allocates and initializes with key and value
+** One block for the variable, its name and its value (if any), so
+** importing a variable is one allocation
 */
-t_env	*create_env_node(char *key, char *value)
+t_var	*env_var_new(const char *key, size_t klen, const char *value)
 {
-	t_env	*node;
+	t_var	*var;
+	size_t	vlen;
 
-	node = malloc(sizeof(t_env));
-	if (!node)
+	vlen = 0;
+	if (value)
+		vlen = ft_strlen(value) + 1;
+	var = malloc(sizeof(t_var) + klen + 1 + vlen);
+	if (!var)
 		return (NULL);
-	node->key = ft_strdup(key);
+	ft_bzero(var, sizeof(t_var));
+	var->key = (char *)(var + 1);
+	ft_memcpy(var->key, key, klen);
+	var->key[klen] = '\0';
 	if (value)
-		node->value = ft_strdup(value);
-	else
-		node->value = NULL;
-	node->next = NULL;
-	return (node);
+	{
+		var->value = var->key + klen + 1;
+		ft_memcpy(var->value, value, vlen);
+	}
+	return (var);
 }
 
 /*
-** Add environment node to the end of the list
-** Traverses to last node and appends new node
+** Create a new environment variable
+** Allocates and initializes with key and value
 */
-void	add_env_node(t_env **env, t_env *new_node)
+t_var	*create_env_node(char *key, char *value)
 {
-	t_env	*current;
+	return (env_var_new(key, ft_strlen(key), value));
+}
 
-	if (!*env)
-	{
-		*env = new_node;
+/*
+** Add a variable after the ones already set
+** The environment is created on first use; a key that is already set
+** keeps its first value, as lookups always did
+*/
+void	add_env_node(t_env **env, t_var *new_node)
+{
+	if (!new_node)
 		return ;
-	}
-	current = *env;
-	while (current->next)
-		current = current->next;
-	current->next = new_node;
+	if (!*env)
+		*env = env_new();
+	if (!*env || !env_link(*env, new_node))
+		env_free_var(new_node);
 }
 
 /*
 ** Remove environment variable by key
-** Frees the node and updates the list
+** Frees the variable and takes it out of the index
 */
 void	remove_env_node(t_env **env, char *key)
 {
-	t_env	*current;
-	t_env	*prev;
+	t_var	*var;
 
-	current = *env;
-	prev = NULL;
-	while (current)
-	{
-		if (ft_strcmp(current->key, key) == 0)
-		{
-			if (prev)
-				prev->next = current->next;
-			else
-				*env = current->next;
-			free(current->key);
-			free(current->value);
-			free(current);
-			return ;
-		}
-		prev = current;
-		current = current->next;
-	}
+	var = env_find(*env, key);
+	if (!var)
+		return ;
+	env_unlink(*env, var);
+	env_free_var(var);
 }
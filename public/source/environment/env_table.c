@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_table.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:20:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 20:15:30 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/* FNV-1a over the name */
+uint64_t	env_hash(const char *key)
+{
+	uint64_t	h;
+
+	h = 14695981039346656037ULL;
+	while (*key)
+	{
+		h ^= (unsigned char)*key++;
+		h *= 1099511628211ULL;
+	}
+	return (h);
+}
+
+/* the slot that holds key, or the empty one that ends its run */
+static size_t	env_slot(t_env *env, const char *key, uint64_t h)
+{
+	size_t	mask;
+	size_t	i;
+
+	mask = env->cap - 1;
+	i = h & mask;
+	while (env->slots[i] && (env->slots[i]->hash != h
+			|| ft_strcmp(env->slots[i]->key, key) != 0))
+		i = (i + 1) & mask;
+	return (i);
+}
+
+t_var	*env_find(t_env *env, const char *key)
+{
+	if (!env || !env->cap)
+		return (NULL);
+	return (env->slots[env_slot(env, key, env_hash(key))]);
+}
+
+/*
+** Index var and append it to the order. Returns 0, leaving var to the
+** caller, when its key is already set or when out of memory.
+*/
+int	env_link(t_env *env, t_var *var)
+{
+	size_t	i;
+
+	if (!env_reserve(env, env->count + 1))
+		return (0);
+	var->hash = env_hash(var->key);
+	i = env_slot(env, var->key, var->hash);
+	if (env->slots[i])
+		return (0);
+	env->slots[i] = var;
+	var->next = NULL;
+	var->prev = env->tail;
+	if (env->tail)
+		env->tail->next = var;
+	else
+		env->head = var;
+	env->tail = var;
+	env->count++;
+	env->gen++;
+	return (1);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_table_del.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 19:20:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 20:15:30 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+t_env	*env_new(void)
+{
+	return (ft_calloc(1, sizeof(t_env)));
+}
+
+/*
+** Slot hole was just emptied. Every later entry of the run that may
+** live there (its home slot is not between hole and itself) moves
+** back into it, and the hole moves on to where that entry was.
+*/
+static void	env_backshift(t_env *env, size_t hole)
+{
+	size_t	mask;
+	size_t	j;
+	size_t	home;
+
+	mask = env->cap - 1;
+	j = (hole + 1) & mask;
+	while (env->slots[j])
+	{
+		home = env->slots[j]->hash & mask;
+		if (((j - home) & mask) >= ((j - hole) & mask))
+		{
+			env->slots[hole] = env->slots[j];
+			env->slots[j] = NULL;
+			hole = j;
+		}
+		j = (j + 1) & mask;
+	}
+}
+
+/* take var out of the index and the order; the caller frees it */
+void	env_unlink(t_env *env, t_var *var)
+{
+	size_t	i;
+
+	i = var->hash & (env->cap - 1);
+	while (env->slots[i] != var)
+		i = (i + 1) & (env->cap - 1);
+	env->slots[i] = NULL;
+	env_backshift(env, i);
+	if (var->prev)
+		var->prev->next = var->next;
+	else
+		env->head = var->next;
+	if (var->next)
+		var->next->prev = var->prev;
+	else
+		env->tail = var->prev;
+	env->count--;
+	env->gen++;
+}
+
+/* free a value set after the variable was made; its first one is inline */
+void	env_drop_value(t_var *var)
+{
+	if (var->value && var->value != var->key + ft_strlen(var->key) + 1)
+		free(var->value);
+	var->value = NULL;
+}
+
+void	env_free_var(t_var *var)
+{
+	env_drop_value(var);
+	free(var);
+}
@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_table_grow.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 20:12:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 20:15:30 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/* put every variable into slots, walking them in order */
+static void	env_rehash(t_env *env, t_var **slots, size_t cap)
+{
+	t_var	*v;
+	size_t	i;
+
+	v = env->head;
+	while (v)
+	{
+		i = v->hash & (cap - 1);
+		while (slots[i])
+			i = (i + 1) & (cap - 1);
+		slots[i] = v;
+		v = v->next;
+	}
+}
+
+/*
+** Make the index big enough for n variables, doubling it as often as
+** that takes. The variables themselves do not move.
+*/
+int	env_reserve(t_env *env, size_t n)
+{
+	t_var	**slots;
+	size_t	cap;
+
+	cap = env->cap;
+	if (cap < ENV_INIT)
+		cap = ENV_INIT;
+	while (cap < n * 2)
+		cap *= 2;
+	if (cap == env->cap)
+		return (1);
+	slots = ft_calloc(cap, sizeof(t_var *));
+	if (!slots)
+		return (0);
+	env_rehash(env, slots, cap);
+	free(env->slots);
+	env->slots = slots;
+	env->cap = cap;
+	return (1);
+}
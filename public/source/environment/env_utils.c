@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/06 15:04:12 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 20:15:30 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -33,75 +33,23 @@ void	parse_env_string(char *env_str, char **key, char **value)
 	}
 }
 
-/*
-** Count environment variables
-** Returns the number of nodes in the list
-*/
-static int	count_env(t_env *env)
-{
-	int	count;
-
-	count = 0;
-	while (env)
-	{
-		if (env->value)
-			count++;
-		env = env->next;
-	}
-	return (count);
-}
-
-/*
-** Convert environment list to array
-** Creates char** array in KEY=VALUE format for execve
-*/
-char	**env_to_array(t_env *env)
-{
-	char	**envp;
-	char	*tmp;
-	int		i;
-
-	envp = malloc(sizeof(char *) * (count_env(env) + 1));
-	if (!envp)
-		return (NULL);
-	i = 0;
-	while (env)
-	{
-		if (env->value)
-		{
-			tmp = ft_strjoin(env->key, "=");
-			envp[i] = ft_strjoin(tmp, env->value);
-			free(tmp);
-			i++;
-		}
-		env = env->next;
-	}
-	envp[i] = NULL;
-	return (envp);
-}
-
 /*
 ** Update or add environment variable
-** If key exists, update value; otherwise create new node
+** If key exists, update value; otherwise add it after the others
 ** Duplicates the value (if not NULL)
 */
 void	env_set_value(t_env **env, char *key, char *value)
 {
-	t_env	*cur;
+	t_var	*cur;
 
-	cur = *env;
-	while (cur)
+	cur = env_find(*env, key);
+	if (!cur)
 	{
-		if (ft_strcmp(cur->key, key) == 0)
-		{
-			free(cur->value);
-			if (value)
-				cur->value = ft_strdup(value);
-			else
-				cur->value = NULL;
-			return ;
-		}
-		cur = cur->next;
+		add_env_node(env, create_env_node(key, value));
+		return ;
 	}
-	add_env_node(env, create_env_node(key, value));
+	env_drop_value(cur);
+	if (value)
+		cur->value = ft_strdup(value);
+	(*env)->gen++;
 }
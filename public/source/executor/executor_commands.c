@@ -1,73 +0,0 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   executor_commands.c                                :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2024/11/04 00:00:00 by your_login        #+#    #+#             */
-/*   Updated: 2025/11/20 00:00:00 by malmarzo         ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../minishell.h"
-
-/* reset signals to default in child so Ctrl-C behaves like bash */
-static void	setup_child_signals(void)
-{
-	struct sigaction	sa;
-
-	sa.sa_handler = SIG_DFL;
-	sigemptyset(&sa.sa_mask);
-	sa.sa_flags = 0;
-	sigaction(SIGINT, &sa, NULL);
-	sigaction(SIGQUIT, &sa, NULL);
-}
-
-static void	execute_builtin_with_redir(t_cmd *cmd, t_shell *shell)
-{
-	pid_t	pid;
-	int		status;
-
-	pid = fork();
-	if (pid == 0)
-	{
-		setup_child_signals();
-		if (setup_redirections(cmd->redirs) == -1)
-			exit(1);
-		exit(execute_builtin(cmd, shell));
-	}
-	signal(SIGINT, SIG_IGN);
-	signal(SIGQUIT, SIG_IGN);
-	waitpid(pid, &status, 0);
-	if (WIFEXITED(status))
-		shell->exit_status = WEXITSTATUS(status);
-	signal(SIGINT, handle_sigint);
-	signal(SIGQUIT, handle_sigquit);
-}
-
-int	is_directory(const char *path)
-{
-	struct stat	st;
-
-	if (stat(path, &st) == -1)
-		return (0);
-	if (S_ISDIR(st.st_mode))
-		return (1);
-	return (0);
-}
-
-void	execute_commands(t_cmd *cmd, t_shell *shell)
-{
-	if (!cmd || !cmd->args || !cmd->args[0])
-		return ;
-	if (is_builtin(cmd->args[0]))
-	{
-		if (cmd->redirs)
-			execute_builtin_with_redir(cmd, shell);
-		else
-			shell->exit_status = execute_builtin(cmd, shell);
-	}
-	else
-		execute_external(cmd, shell);
-}
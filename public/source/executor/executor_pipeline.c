@@ -6,21 +6,51 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/05 15:38:52 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 20:42:10 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
+/*
+** Expand one pipeline and lower it into its plan (see plan.h) right
+** before it runs, so its words see what ran before it on the line.
+*/
+static void	run_pipeline(t_pipeline *pl, t_shell *shell)
+{
+	t_plan	*plan;
+
+	expand_pipeline_cmds(pl->cmds, shell->env, shell->exit_status);
+	plan = plan_compile(pl->cmds);
+	if (!plan)
+	{
+		print_error("executor", "out of memory");
+		shell->exit_status = 1;
+		return ;
+	}
+	if (shell->dump_plan)
+		plan_dump(plan);
+	plan_run(plan, shell);
+}
+
+/*
+** Run the and/or lists of a line. After && the next pipeline only runs
+** on success, after || only on failure; a skipped one leaves $? as it
+** was and passes the test on, so `a && b || c` runs c when a or b
+** failed, and `;` always runs what follows. exit stops the line.
+*/
 void	executor(t_pipeline *pipeline, t_shell *shell)
 {
-	while (pipeline)
+	t_token_type	op;
+
+	op = TOKEN_SEMICOLON;
+	while (pipeline && !shell->should_exit)
 	{
-		shell->exit_status = execute_pipeline(pipeline->cmds, shell);
-		if (pipeline->logic_op == TOKEN_AND && shell->exit_status != 0)
-			break ;
-		if (pipeline->logic_op == TOKEN_OR && shell->exit_status == 0)
-			break ;
+		if ((op != TOKEN_AND && op != TOKEN_OR)
+			|| (op == TOKEN_AND && shell->exit_status == 0)
+			|| (op == TOKEN_OR && shell->exit_status != 0))
+			run_pipeline(pipeline, shell);
+		op = pipeline->logic_op;
 		pipeline = pipeline->next;
 	}
 }
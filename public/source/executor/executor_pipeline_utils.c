@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/04 00:00:00 by your_login        #+#    #+#             */
-/*   Updated: 2025/11/05 15:47:05 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/18 01:40:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,6 +21,19 @@ void	print_error(const char *function, const char *message)
 	ft_putstr_fd("\n", STDERR_FILENO);
 }
 
+/*
+** fd as to for the program about to be run. What the shell opens is
+** close-on-exec and dup2() clears that on the copy; when fd already is
+** to (the shell was started with to closed) there is no copy, so the
+** flag is cleared on fd itself.
+*/
+int	fd_to(int fd, int to)
+{
+	if (fd == to)
+		return (fcntl(fd, F_SETFD, 0));
+	return (dup2(fd, to));
+}
+
 void	safe_close(int fd)
 {
 	if (fd >= 0)
@@ -29,37 +42,3 @@ void	safe_close(int fd)
 			print_error("close", strerror(errno));
 	}
 }
-
-void	cleanup_pipe(int pipefd[2])
-{
-	safe_close(pipefd[0]);
-	safe_close(pipefd[1]);
-}
-
-int	count_commands(t_cmd *cmds)
-{
-	int		count;
-	t_cmd	*current;
-
-	count = 0;
-	current = cmds;
-	while (current)
-	{
-		count++;
-		current = current->next;
-	}
-	return (count);
-}
-
-int	create_pipe_if_needed(t_cmd *current, int pipefd[2])
-{
-	if (current->next)
-	{
-		if (pipe(pipefd) == -1)
-		{
-			print_error("pipe", strerror(errno));
-			return (-1);
-		}
-	}
-	return (0);
-}
@@ -6,103 +6,125 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/23 11:48:00 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/18 01:40:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
-static int	write_heredoc_line(int pipe_fd, char *line, int quoted)
+/*
+** The body as typed. readline's buffer has room for the newline where
+** its terminator was, so a line goes into the buffer in one copy. A $
+** in the body of an unquoted delimiter is expanded when the command
+** runs, as in bash.
+*/
+static int	read_body(t_redir *r, t_exp_ctx *c, char *clean, int quoted)
 {
-	char	*exp;
+	char	*line;
+	size_t	len;
+	int		err;
 
-	exp = get_expanded_line(line, quoted);
-	if (!exp)
+	err = 0;
+	while (!err)
+	{
+		line = readline("> ");
+		if (g_shell.heredoc_sigint || check_heredoc_end(line, clean))
+			break ;
+		if (!quoted && ft_strchr(line, '$'))
+			r->expand = 1;
+		len = ft_strlen(line);
+		line[len] = '\n';
+		err = heredoc_put(c, r->fd, line, len + 1);
+		free(line);
+		line = NULL;
+	}
+	free(line);
+	if (err)
 		return (-1);
-	write(pipe_fd, exp, ft_strlen(exp));
-	write(pipe_fd, "\n", 1);
-	free(exp);
-	return (0);
+	return (heredoc_flush(c, r->fd));
 }
 
-static int	process_heredoc_line(int pipe_fd, char *clean, int quoted)
+static int	collect_one(t_redir *r, t_exp_ctx *c)
 {
-	char	*line;
+	char	*clean;
+	int		quoted;
+	int		err;
 
-	line = readline("> ");
+	if (!c->result && heredoc_buf_init(c) == -1)
+		return (-1);
+	clean = clean_delimiter(r->file, &quoted);
+	if (clean)
+		r->fd = heredoc_file();
+	if (!clean || r->fd < 0)
+		return (-1);
+	g_shell.in_heredoc = 1;
+	g_shell.heredoc_sigint = 0;
+	setup_signals();
+	err = read_body(r, c, clean, quoted);
+	g_shell.in_heredoc = 0;
+	setup_signals();
 	if (g_shell.heredoc_sigint)
-	{
-		free(line);
-		return (1);
-	}
-	if (check_heredoc_end(line, clean))
-	{
-		free(line);
-		return (1);
-	}
-	if (write_heredoc_line(pipe_fd, line, quoted) == -1)
-	{
-		free(line);
 		return (-1);
-	}
-	free(line);
+	if (err || lseek(r->fd, 0, SEEK_SET) == -1)
+		return (-1);
 	return (0);
 }
 
-static int	read_heredoc_lines(int pipe_fd, char *clean, int quoted)
+static int	collect_all(t_pipeline *pl, t_exp_ctx *c)
 {
-	int	result;
+	t_cmd	*cmd;
+	t_redir	*r;
 
-	while (1)
+	while (pl)
 	{
-		if (g_shell.heredoc_sigint)
-			break ;
-		result = process_heredoc_line(pipe_fd, clean, quoted);
-		if (result != 0)
-			return (result);
+		cmd = pl->cmds;
+		while (cmd)
+		{
+			r = cmd->redirs;
+			while (r)
+			{
+				if (r->type == TOKEN_REDIR_HEREDOC && collect_one(r, c) == -1)
+					return (-1);
+				r = r->next;
+			}
+			cmd = cmd->next;
+		}
+		pl = pl->next;
 	}
 	return (0);
 }
 
-static int	finalize_heredoc(int *pipe_fd)
+/*
+** Every heredoc of the line, in the order they were written, read by
+** the shell before anything runs: children never share the terminal
+** with it, and a line cut short by Ctrl-C runs nothing, with $? 130.
+** All of them go through one buffer, made for the first. The bodies
+** stay open until heredoc_close() after the line.
+*/
+int	heredoc_collect(t_pipeline *pl)
 {
-	close(pipe_fd[1]);
-	g_shell.in_heredoc = 0;
-	setup_signals();
-	if (g_shell.heredoc_sigint)
-	{
-		close(pipe_fd[0]);
-		g_shell.exit_status = 130;
-		return (-1);
-	}
-	dup2(pipe_fd[0], STDIN_FILENO);
-	close(pipe_fd[0]);
+	t_arena_mark	mark;
+	t_exp_ctx		c;
+	int				err;
+
+	mark = arena_mark(&g_shell.arena);
+	c.result = NULL;
+	err = collect_all(pl, &c);
+	arena_release(&g_shell.arena, mark);
+	if (err)
+		return (heredoc_failed());
 	return (0);
 }
 
-int	handle_heredoc(char *delimiter)
+/* the redirection itself: the body becomes stdin */
+int	handle_heredoc(t_redir *r)
 {
-	int		pipe_fd[2];
-	int		quoted;
-	char	*clean;
-
-	if (pipe(pipe_fd) == -1)
+	if (r->fd < 0)
 		return (-1);
-	clean = clean_delimiter(delimiter, &quoted);
-	if (!clean)
+	if (fd_to(r->fd, STDIN_FILENO) == -1)
 	{
-		cleanup_pipe(pipe_fd);
+		print_error("dup2", "failed to redirect stdin");
 		return (-1);
 	}
-	g_shell.in_heredoc = 1;
-	g_shell.heredoc_sigint = 0;
-	setup_signals();
-	if (read_heredoc_lines(pipe_fd[1], clean, quoted) == -1)
-	{
-		free(clean);
-		cleanup_pipe(pipe_fd);
-		return (-1);
-	}
-	free(clean);
-	return (finalize_heredoc(pipe_fd));
+	return (0);
 }
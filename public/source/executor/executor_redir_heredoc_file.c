@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_redir_heredoc_file.c                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:40:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 00:20:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+#include <sys/mman.h>
+
+/*
+** A heredoc body goes to an anonymous file: memfd_create(), or an
+** unnamed file in /tmp where that is missing. A child gets it as its
+** stdin with one dup2() and reads it at its own pace; a pipe written
+** before its reader exists blocks the shell once the body outgrows it.
+*/
+int	heredoc_file(void)
+{
+	int	fd;
+
+	fd = memfd_create("heredoc", MFD_CLOEXEC);
+	if (fd < 0)
+		fd = open("/tmp", O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+	return (fd);
+}
+
+/*
+** The lines with no $ go out as they are, as many at a time as there
+** are; the line with the next $ is cut at its newline and expanded.
+** The mapping is private, so cutting it leaves the file alone.
+*/
+static int	expand_body(t_exp_ctx *c, int fd, char *body, char *end)
+{
+	char	*dol;
+	char	*line;
+	char	*nl;
+
+	while (body < end)
+	{
+		dol = ft_memchr(body, '$', end - body);
+		if (!dol)
+			return (heredoc_put(c, fd, body, end - body));
+		line = dol;
+		while (line > body && line[-1] != '\n')
+			line--;
+		nl = ft_memchr(dol, '\n', end - dol);
+		if (!nl || heredoc_put(c, fd, body, line - body) == -1)
+			return (-1);
+		*nl = '\0';
+		if (heredoc_put_expanded(c, fd, line) == -1)
+			return (-1);
+		body = nl + 1;
+	}
+	return (0);
+}
+
+static int	expand_into(t_exp_ctx *c, int fd, int from)
+{
+	struct stat	st;
+	char		*body;
+	int			err;
+
+	if (fstat(from, &st) == -1)
+		return (-1);
+	body = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+			from, 0);
+	if (body == MAP_FAILED)
+		return (-1);
+	err = expand_body(c, fd, body, body + st.st_size);
+	munmap(body, st.st_size);
+	if (err || heredoc_flush(c, fd) == -1)
+		return (-1);
+	return (0);
+}
+
+/*
+** An unquoted body with a $ in it is expanded as the command that
+** reads it is about to run, so it sees the variables and the $? of
+** that moment, as in bash. The body is mapped, and goes through the
+** heredoc buffer to a new file that takes its place.
+*/
+void	heredoc_expand(t_redir *r)
+{
+	t_arena_mark	mark;
+	t_exp_ctx		c;
+	int				fd;
+
+	r->expand = 0;
+	mark = arena_mark(&g_shell.arena);
+	fd = -1;
+	if (heredoc_buf_init(&c) == 0)
+		fd = heredoc_file();
+	if (fd >= 0 && (expand_into(&c, fd, r->fd) == -1
+			|| lseek(fd, 0, SEEK_SET) == -1))
+	{
+		close(fd);
+		fd = -1;
+	}
+	arena_release(&g_shell.arena, mark);
+	if (fd < 0)
+		print_error("heredoc", strerror(errno));
+	close(r->fd);
+	r->fd = fd;
+}
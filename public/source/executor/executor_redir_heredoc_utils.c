@@ -6,18 +6,32 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/23 00:00:00 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/23 11:48:00 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/18 00:20:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
+/*
+** The delimiter is still the word from the line, so its quotes are the
+** drop bits of the line's quote mask over its span.
+*/
 char	*clean_delimiter(char *delim, int *quoted)
 {
-	*quoted = (ft_strchr(delim, '\'') || ft_strchr(delim, '"'));
+	long	off;
+	size_t	base;
+	size_t	end;
+
+	off = line_offset(delim);
+	*quoted = 0;
+	if (off < 0)
+		return (delim);
+	base = (size_t)off;
+	end = base + ft_strlen(delim);
+	*quoted = qm_next(g_shell.line.qm.drop, base, end) < end;
 	if (*quoted)
-		return (remove_quotes(delim));
-	return (ft_strdup(delim));
+		return (remove_quotes(delim, g_shell.line.qm.drop, base));
+	return (delim);
 }
 
 int	check_heredoc_end(char *line, char *clean)
@@ -36,13 +50,40 @@ int	check_heredoc_end(char *line, char *clean)
 	return (0);
 }
 
-char	*get_expanded_line(char *line, int quoted)
+/* quoted delimiter: body is taken verbatim, otherwise expanded in the arena */
+/* a heredoc that could not be read stops the line: $? 130 or 1 */
+int	heredoc_failed(void)
+{
+	if (g_shell.heredoc_sigint)
+	{
+		g_shell.exit_status = 130;
+		return (-1);
+	}
+	print_error("heredoc", strerror(errno));
+	g_shell.exit_status = 1;
+	return (-1);
+}
+
+void	heredoc_close(t_pipeline *pl)
 {
-	char	*exp;
+	t_cmd	*cmd;
+	t_redir	*r;
 
-	if (quoted)
-		exp = ft_strdup(line);
-	else
-		exp = expand_variables(line, g_shell.env, g_shell.exit_status);
-	return (exp);
+	while (pl)
+	{
+		cmd = pl->cmds;
+		while (cmd)
+		{
+			r = cmd->redirs;
+			while (r)
+			{
+				if (r->fd >= 0)
+					close(r->fd);
+				r->fd = -1;
+				r = r->next;
+			}
+			cmd = cmd->next;
+		}
+		pl = pl->next;
+	}
 }
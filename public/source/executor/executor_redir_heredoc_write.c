@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_redir_heredoc_write.c                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:20:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 00:20:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static int	write_all(int fd, const char *s, size_t n)
+{
+	ssize_t	k;
+
+	while (n > 0)
+	{
+		k = write(fd, s, n);
+		if (k <= 0)
+			return (-1);
+		s += k;
+		n -= k;
+	}
+	return (0);
+}
+
+/*
+** The buffer is an expander result that never gets a word of the line:
+** no quote mask, no quote removal. It only grows past HEREDOC_FLUSH for
+** a single expanded line longer than that.
+*/
+int	heredoc_buf_init(t_exp_ctx *c)
+{
+	c->base = -1;
+	c->unquote = 0;
+	c->j = 0;
+	c->env = g_shell.env;
+	c->exit_status = g_shell.exit_status;
+	c->cap = HEREDOC_FLUSH + 1;
+	c->result = arena_alloc(&g_shell.arena, c->cap);
+	if (!c->result)
+		return (-1);
+	return (0);
+}
+
+int	heredoc_flush(t_exp_ctx *c, int fd)
+{
+	int	err;
+
+	err = write_all(fd, c->result, c->j);
+	c->j = 0;
+	return (err);
+}
+
+/* n bytes as they are; a run longer than the buffer goes out directly */
+int	heredoc_put(t_exp_ctx *c, int fd, const char *s, size_t n)
+{
+	if ((size_t)c->j + n > HEREDOC_FLUSH && heredoc_flush(c, fd) == -1)
+		return (-1);
+	if (n >= HEREDOC_FLUSH)
+		return (write_all(fd, s, n));
+	ft_memcpy(c->result + c->j, s, n);
+	c->j += n;
+	return (0);
+}
+
+/* line expanded into the buffer, then its newline */
+int	heredoc_put_expanded(t_exp_ctx *c, int fd, char *line)
+{
+	c->str = line;
+	c->i = 0;
+	if (!exp_run(c) || !exp_append(c, "\n", 1))
+		return (-1);
+	if ((size_t)c->j >= HEREDOC_FLUSH)
+		return (heredoc_flush(c, fd));
+	return (0);
+}
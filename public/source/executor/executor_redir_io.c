@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/13 12:50:35 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/18 01:40:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,8 +15,9 @@
 int	handle_input(char *file)
 {
 	int	fd;
+	int	err;
 
-	fd = open(file, O_RDONLY);
+	fd = open(file, O_RDONLY | O_CLOEXEC);
 	if (fd == -1)
 	{
 		ft_putstr_fd("minishell: ", 2);
@@ -24,21 +25,25 @@ int	handle_input(char *file)
 		ft_putendl_fd(": No such file or directory", 2);
 		return (-1);
 	}
-	dup2(fd, STDIN_FILENO);
-	close(fd);
-	return (0);
+	err = fd_to(fd, STDIN_FILENO) == -1;
+	if (fd != STDIN_FILENO)
+		close(fd);
+	if (err)
+		print_error("dup2", strerror(errno));
+	return (-err);
 }
 
 int	handle_output(char *file, int append)
 {
 	int	fd;
 	int	flags;
+	int	err;
 
 	if (append)
 		flags = O_WRONLY | O_CREAT | O_APPEND;
 	else
 		flags = O_WRONLY | O_CREAT | O_TRUNC;
-	fd = open(file, flags, 0644);
+	fd = open(file, flags | O_CLOEXEC, 0644);
 	if (fd == -1)
 	{
 		ft_putstr_fd("minishell: ", 2);
@@ -46,7 +51,10 @@ int	handle_output(char *file, int append)
 		ft_putendl_fd(": Permission denied", 2);
 		return (-1);
 	}
-	dup2(fd, STDOUT_FILENO);
-	close(fd);
-	return (0);
+	err = fd_to(fd, STDOUT_FILENO) == -1;
+	if (fd != STDOUT_FILENO)
+		close(fd);
+	if (err)
+		print_error("dup2", strerror(errno));
+	return (-err);
 }
@@ -6,13 +6,13 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/13 12:50:35 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 23:40:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
-static int	process_single_redirection(t_redir *redir)
+int	apply_redirection(t_redir *redir)
 {
 	if (redir->type == TOKEN_REDIR_IN)
 		return (handle_input(redir->file));
@@ -21,17 +21,6 @@ static int	process_single_redirection(t_redir *redir)
 	else if (redir->type == TOKEN_REDIR_APPEND)
 		return (handle_output(redir->file, 1));
 	else if (redir->type == TOKEN_REDIR_HEREDOC)
-		return (handle_heredoc(redir->file));
-	return (0);
-}
-
-int	setup_redirections(t_redir *redirs)
-{
-	while (redirs)
-	{
-		if (process_single_redirection(redirs) == -1)
-			return (-1);
-		redirs = redirs->next;
-	}
+		return (handle_heredoc(redir));
 	return (0);
 }
@@ -0,0 +1,41 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc.h                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 00:20:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 00:20:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HEREDOC_H
+# define HEREDOC_H
+
+/*
+** Heredocs. The shell reads every body of a line before the line runs
+** (heredoc_collect()), each into an anonymous file that a child takes
+** as its stdin with one dup2(). An unquoted body with a $ in it is
+** expanded into a new file as its pipeline is about to run
+** (heredoc_expand()).
+**
+** Both write through one buffer, a t_exp_ctx whose result is flushed
+** to the file whenever it holds HEREDOC_FLUSH bytes, so a body costs
+** one write() per HEREDOC_FLUSH bytes rather than one per line. Lines
+** with no $ are copied into it as they are, many at a time; a line
+** with one is expanded straight into it.
+*/
+# define HEREDOC_FLUSH	16384
+
+int		heredoc_collect(t_pipeline *pl);
+void	heredoc_close(t_pipeline *pl);
+int		heredoc_failed(void);
+int		heredoc_file(void);
+void	heredoc_expand(t_redir *r);
+int		heredoc_buf_init(t_exp_ctx *c);
+int		heredoc_flush(t_exp_ctx *c, int fd);
+int		heredoc_put(t_exp_ctx *c, int fd, const char *s, size_t n);
+int		heredoc_put_expanded(t_exp_ctx *c, int fd, char *line);
+
+#endif
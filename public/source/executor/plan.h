@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:48:26 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 09:30:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PLAN_H
+# define PLAN_H
+
+/*
+** Execution plan ("shell bytecode").
+** executor() expands each pipeline of a line and lowers it into one
+** flat array of instructions right before plan_run() interprets it;
+** nothing after the compile step walks t_cmd/t_redir again. && and ||
+** are decided by executor() between plans. Where a command runs
+** (shell or child), which builtin it is and which file a program name
+** resolves to are all decided by the compiler.
+**
+** OP_FORK splits the flow: the child falls through into its block
+** (fd setup, redirections, the command) which always ends in OP_EXIT,
+** while the shell carries on at a. An OP_SPAWN in front of it starts
+** a program whose child would only set up fds and exec with
+** posix_spawn() instead, and skips the fork and the block. Jumps are
+** absolute indexes; the array always ends with OP_END. Run with
+** --dump-plan to see every pipeline's plan on stderr before it runs.
+*/
+typedef enum e_op
+{
+	OP_STATUS,
+	OP_PIPE,
+	OP_FORK,
+	OP_SPAWN,
+	OP_STDIN,
+	OP_STDOUT,
+	OP_REDIR,
+	OP_SAVE,
+	OP_RESTORE,
+	OP_BUILTIN,
+	OP_RESOLVE,
+	OP_EXEC,
+	OP_EXIT,
+	OP_NEXT,
+	OP_WAIT,
+	OP_END
+}	t_op;
+
+/*
+** a and b by op:
+**   OP_STATUS     a: new $?
+**   OP_REDIR      a: in the shell, the OP_RESTORE to go to on failure
+**   OP_SAVE       a: the OP_RESTORE to go to on failure, b: a bit per
+**                 fd the redirections replace
+**   OP_FORK       a: where the shell goes on, b: pid slot
+**   OP_SPAWN      the same as the OP_FORK after it
+**   OP_BUILTIN    a: t_builtin id
+**   OP_RESOLVE    a: where to go when there is no program to run,
+**                 b: 0, or the status that says why (126, 127)
+**   OP_NEXT       a: 1 if a pipe to the next stage was opened
+**   OP_WAIT       [a, b): pid slots of the pipeline, $? is the last one's
+**                 or, with pipefail, the last failed one's
+** cmd is the command OP_BUILTIN/OP_RESOLVE/OP_EXEC run, redir the one
+** OP_REDIR applies, path what OP_RESOLVE found for OP_EXEC.
+*/
+typedef struct s_instr
+{
+	t_op	op;
+	int		a;
+	int		b;
+	t_cmd	*cmd;
+	t_redir	*redir;
+	char	*path;
+}	t_instr;
+
+typedef struct s_plan
+{
+	t_instr	*code;
+	int		len;
+	int		cap;
+	int		slots;
+}	t_plan;
+
+/*
+** Interpreter state. path is the program the last OP_RESOLVE found.
+** prev_rd is the read end the next stage takes as stdin, pipe_rd and
+** pipe_wr the pipe the current stage writes into. saved holds the
+** shell's own stdin and stdout while a builtin runs with redirections
+** (-1 when not saved, SAVED_CLOSED when the shell started without that
+** fd, so it is closed again afterwards). failed means a pipe or fork
+** failed: no further stage is started and the pipeline's
+** status is 1 once the ones already running are reaped. stages has a
+** slot per stage that runs in a child; reaped is set once OP_WAIT
+** has filled them in.
+*/
+typedef struct s_run
+{
+	t_shell	*shell;
+	t_stage	*stages;
+	int		reaped;
+	char	*path;
+	int		prev_rd;
+	int		pipe_rd;
+	int		pipe_wr;
+	int		child;
+	int		saved[2];
+	int		failed;
+}	t_run;
+
+# define PLAN_INIT	32
+# define SPAWN_REDIRS	16
+# define SAVED_CLOSED	-2
+
+/*
+** Everything the shell opens is close-on-exec: pipes, redirections,
+** heredoc files, saved fds, PATH directories. A program gets only the
+** fds a dup2() put in place. Build with -D FD_DEBUG=1 to have every
+** child list on stderr the fds the program it execs inherits (the
+** first FD_DEBUG_MAX). Every program is forked then, so the list comes
+** from the child itself, right before execve().
+*/
+# ifndef FD_DEBUG
+#  define FD_DEBUG 0
+# endif
+
+# define FD_DEBUG_MAX	256
+
+t_plan		*plan_compile(t_cmd *cmds);
+int			plan_emit(t_plan *plan, t_op op, int a, int b);
+int			plan_compile_pipe(t_plan *p, t_cmd *cmds);
+int			plan_emit_cmd(t_plan *plan, t_op op, int a, t_cmd *cmd);
+int			plan_emit_redirs(t_plan *plan, t_redir *r);
+int			plan_emit_spawn(t_plan *p, t_cmd *cmd, t_builtin id, char *path);
+void		plan_patch_spawn(t_plan *p, int spawn);
+int			plan_emit_body(t_plan *plan, t_cmd *cmd, t_builtin id,
+				int resolve);
+void		plan_resolve(t_instr *in);
+void		plan_run(t_plan *plan, t_shell *shell);
+void		plan_dump(t_plan *plan);
+int			op_pipe(t_run *r, t_instr *in, int pc);
+int			op_fork(t_run *r, t_instr *in, int pc);
+int			op_spawn(t_run *r, t_instr *in, int pc);
+int			op_next(t_run *r, t_instr *in, int pc);
+int			op_wait(t_run *r, t_instr *in, int pc);
+int			op_stdio(t_run *r, t_instr *in, int pc);
+int			op_redir(t_run *r, t_instr *in, int pc);
+int			op_save(t_run *r, t_instr *in, int pc);
+int			op_restore(t_run *r, t_instr *in, int pc);
+int			op_builtin(t_run *r, t_instr *in, int pc);
+int			op_resolve(t_run *r, t_instr *in, int pc);
+int			op_exec(t_run *r, t_instr *in, int pc);
+int			exec_error(char *name);
+void		fd_debug(const char *name);
+
+#endif
@@ -0,0 +1,115 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_compile.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:48:26 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 21:58:20 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/* a bit per fd the redirections replace */
+static int	redir_fds(t_redir *r)
+{
+	int	fds;
+
+	fds = 0;
+	while (r)
+	{
+		if (r->type == TOKEN_REDIR_IN || r->type == TOKEN_REDIR_HEREDOC)
+			fds |= 1 << STDIN_FILENO;
+		else
+			fds |= 1 << STDOUT_FILENO;
+		r = r->next;
+	}
+	return (fds);
+}
+
+/*
+** A builtin runs in the shell itself. Its redirections are applied
+** there too, over copies of the fds they replace which OP_RESTORE puts
+** back; the first one that fails skips the builtin.
+*/
+static int	compile_in_shell(t_plan *p, t_cmd *cmd, t_builtin id)
+{
+	int	save;
+	int	restore;
+
+	if (!cmd->redirs)
+		return (plan_emit_cmd(p, OP_BUILTIN, id, cmd) >= 0);
+	save = plan_emit(p, OP_SAVE, 0, redir_fds(cmd->redirs));
+	if (save < 0 || !plan_emit_redirs(p, cmd->redirs)
+		|| plan_emit_cmd(p, OP_BUILTIN, id, cmd) < 0)
+		return (0);
+	restore = plan_emit(p, OP_RESTORE, 0, 0);
+	if (restore < 0)
+		return (0);
+	while (save < restore)
+	{
+		if (p->code[save].op == OP_SAVE || p->code[save].op == OP_REDIR)
+			p->code[save].a = restore;
+		save++;
+	}
+	return (1);
+}
+
+/*
+** A pipeline of one command. Builtins run in the shell, see above;
+** anything else gets a child, with the program looked up (and a
+** missing one reported) by the shell before it starts one.
+*/
+static int	compile_single(t_plan *p, t_cmd *cmd)
+{
+	t_builtin	id;
+	int			res;
+	int			spawn;
+	int			fork;
+
+	if (!cmd->args || !cmd->args[0])
+		return (plan_emit(p, OP_STATUS, 0, 0) >= 0);
+	id = builtin_id(cmd->args[0]);
+	if (id != BI_NONE)
+		return (compile_in_shell(p, cmd, id));
+	res = plan_emit_cmd(p, OP_RESOLVE, 0, cmd);
+	spawn = -1;
+	if (res >= 0)
+		spawn = plan_emit_spawn(p, cmd, id, p->code[res].path);
+	fork = plan_emit(p, OP_FORK, 0, p->slots++);
+	if (spawn < 0 || fork < 0 || !plan_emit_body(p, cmd, id, 0))
+		return (0);
+	p->code[fork].a = p->len;
+	if (spawn > 0)
+		plan_patch_spawn(p, spawn);
+	if (plan_emit(p, OP_WAIT, p->slots - 1, p->slots) < 0)
+		return (0);
+	p->code[res].a = p->len;
+	return (1);
+}
+
+/*
+** Lower one expanded pipeline into its plan, in the arena.
+** Returns NULL when the arena runs out.
+*/
+t_plan	*plan_compile(t_cmd *cmds)
+{
+	t_plan	*p;
+	int		ok;
+
+	p = arena_alloc(&g_shell.arena, sizeof(t_plan));
+	if (!p)
+		return (NULL);
+	ft_bzero(p, sizeof(*p));
+	if (!cmds)
+		ok = plan_emit(p, OP_STATUS, 0, 0) >= 0;
+	else if (!cmds->next)
+		ok = compile_single(p, cmds);
+	else
+		ok = plan_compile_pipe(p, cmds);
+	if (!ok || plan_emit(p, OP_END, 0, 0) < 0)
+		return (NULL);
+	return (p);
+}
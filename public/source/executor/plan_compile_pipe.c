@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_compile_pipe.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:48:26 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 10:05:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** One stage: a pipe to the next stage, the child block, then the
+** shell's side of the pipe. The program is looked up here, in the
+** shell, while the plan is compiled: before any fork and before the
+** stage's redirections. The child's OP_RESOLVE only reports a failed
+** lookup, after its redirections, and exits 126 or 127. A stage with
+** no words still gets its place in the pipe: it reads nothing, writes
+** nothing and exits 0, so its neighbours see EOF rather than the
+** shell's fds.
+*/
+static int	compile_stage(t_plan *p, t_cmd *cmd, int first)
+{
+	t_builtin	id;
+	int			spawn;
+	int			fork;
+
+	id = BI_NONE;
+	if (cmd->args && cmd->args[0])
+		id = builtin_id(cmd->args[0]);
+	if (cmd->next && plan_emit(p, OP_PIPE, 0, 0) < 0)
+		return (0);
+	spawn = plan_emit_spawn(p, cmd, id, NULL);
+	fork = plan_emit(p, OP_FORK, 0, p->slots++);
+	if (spawn < 0 || fork < 0
+		|| (!first && plan_emit(p, OP_STDIN, 0, 0) < 0))
+		return (0);
+	if (cmd->next && plan_emit(p, OP_STDOUT, 0, 0) < 0)
+		return (0);
+	if (!plan_emit_body(p, cmd, id, 1))
+		return (0);
+	p->code[fork].a = p->len;
+	if (spawn > 0)
+		plan_patch_spawn(p, spawn);
+	return (plan_emit(p, OP_NEXT, cmd->next != NULL, 0) >= 0);
+}
+
+/*
+** A pipeline of two or more commands: every stage is forked, then all
+** of them are waited for and the last one gives $?.
+*/
+int	plan_compile_pipe(t_plan *p, t_cmd *cmds)
+{
+	int		first_slot;
+	t_cmd	*cmd;
+
+	first_slot = p->slots;
+	cmd = cmds;
+	while (cmd)
+	{
+		if (!compile_stage(p, cmd, cmd == cmds))
+			return (0);
+		cmd = cmd->next;
+	}
+	return (plan_emit(p, OP_WAIT, first_slot, p->slots) >= 0);
+}
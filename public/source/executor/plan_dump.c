@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_dump.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:48:26 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 21:58:20 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static const char	*op_name(t_op op)
+{
+	const char	*names;
+
+	names = "status    pipe      fork      spawn     stdin     stdout    "
+		"redir     save      restore   builtin   resolve   "
+		"exec      exit      next      wait      end       ";
+	return (names + op * 10);
+}
+
+static void	dump_redir(t_redir *r)
+{
+	if (r->type == TOKEN_REDIR_IN)
+		ft_putstr_fd("< ", 2);
+	else if (r->type == TOKEN_REDIR_OUT)
+		ft_putstr_fd("> ", 2);
+	else if (r->type == TOKEN_REDIR_APPEND)
+		ft_putstr_fd(">> ", 2);
+	else if (r->type == TOKEN_REDIR_HEREDOC)
+		ft_putstr_fd("<< ", 2);
+	ft_putstr_fd(r->file, 2);
+}
+
+static void	dump_resolved(t_instr *in)
+{
+	if (in->path)
+		ft_putstr_fd(in->path, 2);
+	else if (in->b == 126)
+		ft_putstr_fd("(is a directory)", 2);
+	else
+		ft_putstr_fd("(not found)", 2);
+}
+
+static void	dump_args(t_instr *in)
+{
+	if (in->op == OP_FORK || in->op == OP_RESOLVE || in->op == OP_SAVE
+		|| in->op == OP_SPAWN || (in->op == OP_REDIR && in->a))
+	{
+		ft_putstr_fd("-> ", 2);
+		ft_putnbr_fd(in->a, 2);
+		ft_putstr_fd("  ", 2);
+	}
+	if (in->op == OP_FORK || in->op == OP_SPAWN || in->op == OP_WAIT)
+		ft_putstr_fd("pid ", 2);
+	if (in->op == OP_FORK || in->op == OP_SPAWN)
+		ft_putnbr_fd(in->b, 2);
+	if (in->op == OP_SPAWN)
+		ft_putstr_fd("  ", 2);
+	if (in->op == OP_WAIT || in->op == OP_STATUS)
+		ft_putnbr_fd(in->a, 2);
+	if (in->op == OP_WAIT)
+		ft_putstr_fd("..", 2);
+	if (in->op == OP_WAIT)
+		ft_putnbr_fd(in->b - 1, 2);
+	if (in->op == OP_REDIR)
+		dump_redir(in->redir);
+	if (in->op == OP_RESOLVE || in->op == OP_SPAWN)
+		dump_resolved(in);
+	if (in->op == OP_BUILTIN || in->op == OP_EXEC)
+		ft_putstr_fd(in->cmd->args[0], 2);
+}
+
+/*
+** --dump-plan: one instruction per line on stderr, e.g.
+**     3  fork      -> 7  pid 1
+*/
+void	plan_dump(t_plan *plan)
+{
+	int	i;
+
+	ft_putstr_fd("plan: ", 2);
+	ft_putnbr_fd(plan->len, 2);
+	ft_putendl_fd(" instructions", 2);
+	i = 0;
+	while (i < plan->len)
+	{
+		if (i < 10)
+			ft_putstr_fd(" ", 2);
+		ft_putstr_fd("   ", 2);
+		ft_putnbr_fd(i, 2);
+		write(2, "  ", 2);
+		write(2, op_name(plan->code[i].op), 10);
+		dump_args(&plan->code[i]);
+		write(2, "\n", 1);
+		i++;
+	}
+}
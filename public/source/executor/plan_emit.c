@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_emit.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:48:26 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 10:05:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** Append an instruction; returns its index, -1 when the arena is out.
+** The array moves as it grows, so callers keep indexes, not pointers.
+*/
+int	plan_emit(t_plan *plan, t_op op, int a, int b)
+{
+	t_instr	*code;
+	int		cap;
+
+	if (plan->len == plan->cap)
+	{
+		cap = plan->cap * 2;
+		if (cap < PLAN_INIT)
+			cap = PLAN_INIT;
+		code = arena_grow(&g_shell.arena, plan->code,
+				plan->cap * sizeof(t_instr), cap * sizeof(t_instr));
+		if (!code)
+			return (-1);
+		plan->code = code;
+		plan->cap = cap;
+	}
+	ft_bzero(&plan->code[plan->len], sizeof(t_instr));
+	plan->code[plan->len].op = op;
+	plan->code[plan->len].a = a;
+	plan->code[plan->len].b = b;
+	return (plan->len++);
+}
+
+/* an instruction about cmd; OP_RESOLVE looks the program up right away */
+int	plan_emit_cmd(t_plan *plan, t_op op, int a, t_cmd *cmd)
+{
+	int	i;
+
+	i = plan_emit(plan, op, a, 0);
+	if (i < 0)
+		return (-1);
+	plan->code[i].cmd = cmd;
+	if (op == OP_RESOLVE)
+		plan_resolve(&plan->code[i]);
+	return (i);
+}
+
+/* one OP_REDIR per redirection, in order */
+int	plan_emit_redirs(t_plan *plan, t_redir *r)
+{
+	int	i;
+
+	while (r)
+	{
+		i = plan_emit(plan, OP_REDIR, 0, 0);
+		if (i < 0)
+			return (0);
+		plan->code[i].redir = r;
+		r = r->next;
+	}
+	return (1);
+}
+
+/*
+** What a child runs for cmd: its redirections, then the builtin or the
+** program, and the exit. With resolve set the OP_RESOLVE goes here,
+** otherwise the caller emitted one before the fork; either way the
+** shell looked the program up when it was emitted. A command with no
+** words only does its redirections and exits 0.
+*/
+int	plan_emit_body(t_plan *plan, t_cmd *cmd, t_builtin id, int resolve)
+{
+	int	i;
+
+	if (!plan_emit_redirs(plan, cmd->redirs))
+		return (0);
+	i = 0;
+	if (!cmd->args || !cmd->args[0])
+		i = plan_emit(plan, OP_STATUS, 0, 0);
+	else if (id != BI_NONE)
+		i = plan_emit_cmd(plan, OP_BUILTIN, id, cmd);
+	else if (resolve)
+		i = plan_emit_cmd(plan, OP_RESOLVE, plan->len + 2, cmd);
+	if (i >= 0 && id == BI_NONE && cmd->args && cmd->args[0])
+		i = plan_emit_cmd(plan, OP_EXEC, 0, cmd);
+	return (i >= 0 && plan_emit(plan, OP_EXIT, 0, 0) >= 0);
+}
+
+/*
+** Find the program cmd names: a name with a slash is taken as it is
+** (unless it is a directory), anything else comes from the command
+** hash, which searches PATH for names it does not know yet. When
+** there is none, b says why: 126 for a directory, 127 not found.
+*/
+void	plan_resolve(t_instr *in)
+{
+	char	*name;
+	char	*path;
+
+	name = in->cmd->args[0];
+	in->path = NULL;
+	in->b = 0;
+	if (ft_strchr(name, '/'))
+	{
+		if (is_directory(name))
+			in->b = 126;
+		else
+			in->path = name;
+		return ;
+	}
+	path = hash_lookup(&g_shell.hash, name, g_shell.env);
+	if (path)
+		in->path = arena_strdup(&g_shell.arena, path);
+	if (!in->path)
+		in->b = 127;
+}
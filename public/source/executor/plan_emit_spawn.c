@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_emit_spawn.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:40:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 10:30:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** The child of a program only sets up fds and execs, which
+** posix_spawn() can do for it; a builtin child runs shell code, so it
+** keeps fork(). A heredoc is a file the shell already has open.
+*/
+static int	can_spawn(t_cmd *cmd, t_builtin id)
+{
+	t_redir	*r;
+	int		n;
+
+	if (FD_DEBUG || id != BI_NONE || !cmd->args || !cmd->args[0])
+		return (0);
+	n = 0;
+	r = cmd->redirs;
+	while (r)
+	{
+		n++;
+		if (n > SPAWN_REDIRS)
+			return (0);
+		r = r->next;
+	}
+	return (1);
+}
+
+/*
+** OP_SPAWN in front of the OP_FORK of cmd when it can be spawned, for
+** the pid slot that fork takes. path is what the shell already found
+** for it, NULL for a pipeline stage, whose OP_RESOLVE is emitted after
+** this: plan_patch_spawn() copies the path the shell found then.
+** Returns its index, which is never 0, for plan_patch_spawn(); 0 when
+** cmd needs the fork, -1 when out of memory.
+*/
+int	plan_emit_spawn(t_plan *p, t_cmd *cmd, t_builtin id, char *path)
+{
+	int	i;
+
+	if (!can_spawn(cmd, id))
+		return (0);
+	i = plan_emit(p, OP_SPAWN, 0, 0);
+	if (i < 0)
+		return (-1);
+	p->code[i].cmd = cmd;
+	p->code[i].path = path;
+	p->code[i].b = p->slots;
+	return (i);
+}
+
+/*
+** Once the child block is out: the spawn skips past it, and takes the
+** program its OP_RESOLVE found rather than looking it up twice.
+*/
+void	plan_patch_spawn(t_plan *p, int spawn)
+{
+	int	i;
+
+	p->code[spawn].a = p->len;
+	i = p->len - 1;
+	while (i > spawn && p->code[i].op != OP_RESOLVE)
+		i--;
+	if (i > spawn && !p->code[spawn].path)
+		p->code[spawn].path = p->code[i].path;
+}
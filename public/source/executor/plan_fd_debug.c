@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_fd_debug.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:40:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 01:40:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static size_t	put_str(char *buf, size_t at, const char *s, size_t max)
+{
+	size_t	n;
+
+	n = ft_strlen(s);
+	if (n > max)
+		n = max;
+	ft_memcpy(buf + at, s, n);
+	return (at + n);
+}
+
+static size_t	put_num(char *buf, size_t at, int n)
+{
+	char	digits[12];
+	int		k;
+
+	k = 12;
+	digits[--k] = '0' + n % 10;
+	while (n / 10)
+	{
+		n /= 10;
+		digits[--k] = '0' + n % 10;
+	}
+	ft_memcpy(buf + at, digits + k, 12 - k);
+	return (at + 12 - k);
+}
+
+/*
+** FD_DEBUG only, in the child right before execve(): one line on
+** stderr with every fd name inherits, open and not close-on-exec. A
+** pipeline should show 0 1 2 and nothing else. The line goes out in
+** one write so the stages of a pipeline do not mix theirs up.
+*/
+void	fd_debug(const char *name)
+{
+	char	buf[FD_DEBUG_MAX * 4 + 128];
+	size_t	at;
+	int		fd;
+	int		flags;
+
+	at = put_str(buf, 0, "minishell: fd-debug: ", 32);
+	at = put_str(buf, at, name, 64);
+	at = put_str(buf, at, " inherits", 16);
+	fd = 0;
+	while (fd < FD_DEBUG_MAX)
+	{
+		flags = fcntl(fd, F_GETFD);
+		if (flags != -1 && !(flags & FD_CLOEXEC))
+		{
+			buf[at++] = ' ';
+			at = put_num(buf, at, fd);
+		}
+		fd++;
+	}
+	buf[at++] = '\n';
+	write(STDERR_FILENO, buf, at);
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_ops.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:48:26 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 01:40:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+int	op_pipe(t_run *r, t_instr *in, int pc)
+{
+	int	fd[2];
+
+	(void)in;
+	r->pipe_rd = -1;
+	r->pipe_wr = -1;
+	if (r->failed)
+		return (pc + 1);
+	if (pipe2(fd, O_CLOEXEC) == -1)
+	{
+		print_error("pipe", strerror(errno));
+		r->failed = 1;
+		return (pc + 1);
+	}
+	r->pipe_rd = fd[0];
+	r->pipe_wr = fd[1];
+	return (pc + 1);
+}
+
+/*
+** reset signals to default in the child so Ctrl-C behaves like bash.
+** envp is brought up to date first, so the child inherits it.
+*/
+int	op_fork(t_run *r, t_instr *in, int pc)
+{
+	pid_t	pid;
+
+	if (r->failed)
+		return (in->a);
+	env_envp(r->shell->env);
+	pid = fork();
+	if (pid == -1)
+	{
+		print_error("fork", strerror(errno));
+		r->failed = 1;
+		return (in->a);
+	}
+	if (pid == 0)
+	{
+		r->child = 1;
+		signal(SIGINT, SIG_DFL);
+		signal(SIGQUIT, SIG_DFL);
+		return (pc + 1);
+	}
+	r->stages[in->b].pid = pid;
+	r->stages[in->b].start = stage_clock();
+	return (in->a);
+}
+
+/* the shell's side of a stage: the next one reads what this one wrote */
+int	op_next(t_run *r, t_instr *in, int pc)
+{
+	safe_close(r->prev_rd);
+	r->prev_rd = -1;
+	if (in->a)
+	{
+		safe_close(r->pipe_wr);
+		r->prev_rd = r->pipe_rd;
+	}
+	r->pipe_rd = -1;
+	r->pipe_wr = -1;
+	return (pc + 1);
+}
+
+/*
+** Reap the pipeline's children in the order they end, then take $?
+** from their statuses.
+*/
+int	op_wait(t_run *r, t_instr *in, int pc)
+{
+	safe_close(r->prev_rd);
+	r->prev_rd = -1;
+	signal(SIGINT, SIG_IGN);
+	signal(SIGQUIT, SIG_IGN);
+	stages_reap(r->stages + in->a, in->b - in->a);
+	signal(SIGINT, handle_sigint);
+	signal(SIGQUIT, handle_sigquit);
+	r->shell->exit_status = stages_status(r->stages + in->a,
+			in->b - in->a, r->shell->pipefail);
+	if (r->failed)
+		r->shell->exit_status = 1;
+	r->failed = 0;
+	r->reaped = 1;
+	return (pc + 1);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_ops_cmd.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:48:26 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 01:40:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** Child only: the pipe ends become stdin/stdout. The pipe fds are all
+** close-on-exec, so the program gets none but these two copies; a
+** builtin child keeps them until it exits, which holds up nobody.
+*/
+int	op_stdio(t_run *r, t_instr *in, int pc)
+{
+	if (in->op == OP_STDIN && r->prev_rd >= 0
+		&& fd_to(r->prev_rd, STDIN_FILENO) == -1)
+	{
+		print_error("dup2", "failed to redirect stdin");
+		exit(1);
+	}
+	if (in->op == OP_STDOUT && r->pipe_wr >= 0
+		&& fd_to(r->pipe_wr, STDOUT_FILENO) == -1)
+	{
+		print_error("dup2", "failed to redirect stdout");
+		exit(1);
+	}
+	return (pc + 1);
+}
+
+/*
+** A child gives up on the first redirection that fails. The shell
+** skips the builtin to the OP_RESTORE at a instead, with $? 1.
+*/
+int	op_redir(t_run *r, t_instr *in, int pc)
+{
+	if (apply_redirection(in->redir) != -1)
+		return (pc + 1);
+	if (r->child)
+		exit(1);
+	r->shell->exit_status = 1;
+	return (in->a);
+}
+
+int	op_builtin(t_run *r, t_instr *in, int pc)
+{
+	r->shell->exit_status = run_builtin((t_builtin)in->a, in->cmd->args,
+			r->shell);
+	return (pc + 1);
+}
+
+int	op_resolve(t_run *r, t_instr *in, int pc)
+{
+	r->path = in->path;
+	if (in->path)
+		return (pc + 1);
+	if (in->b == 126)
+	{
+		ft_putstr_fd("minishell: ", 2);
+		ft_putstr_fd(in->cmd->args[0], 2);
+		ft_putendl_fd(": is a directory", 2);
+	}
+	else
+		cmd_not_found(in->cmd->args[0]);
+	r->shell->exit_status = in->b;
+	return (in->a);
+}
+
+/* envp is the shell's cached array, normally built before the fork */
+int	op_exec(t_run *r, t_instr *in, int pc)
+{
+	char	**envp;
+
+	envp = env_envp(r->shell->env);
+	if (!envp)
+	{
+		print_error("env_to_array", "allocation failed");
+		r->shell->exit_status = 1;
+		return (pc + 1);
+	}
+	if (FD_DEBUG)
+		fd_debug(in->cmd->args[0]);
+	execve(r->path, in->cmd->args, envp);
+	r->shell->exit_status = exec_error(in->cmd->args[0]);
+	return (pc + 1);
+}
@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_ops_fd.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:05:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 09:30:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** Before a builtin's redirections: copy each fd in b (a bit per fd)
+** above the low ones, closed on exec so no program started later
+** inherits it. An fd the shell was started without (EBADF) has
+** nothing to save: it is marked so that op_restore closes it again.
+** When a copy fails otherwise the builtin is skipped.
+*/
+int	op_save(t_run *r, t_instr *in, int pc)
+{
+	int	fd;
+
+	fd = STDIN_FILENO;
+	while (fd <= STDOUT_FILENO)
+	{
+		if (in->b & (1 << fd))
+		{
+			r->saved[fd] = fcntl(fd, F_DUPFD_CLOEXEC, 10);
+			if (r->saved[fd] == -1 && errno == EBADF)
+				r->saved[fd] = SAVED_CLOSED;
+			else if (r->saved[fd] == -1)
+			{
+				print_error("dup", strerror(errno));
+				r->shell->exit_status = 1;
+				return (in->a);
+			}
+		}
+		fd++;
+	}
+	return (pc + 1);
+}
+
+/*
+** After the builtin: the shell's own stdin and stdout come back, and
+** one it never had is closed again.
+*/
+int	op_restore(t_run *r, t_instr *in, int pc)
+{
+	int	fd;
+
+	(void)in;
+	fd = STDIN_FILENO;
+	while (fd <= STDOUT_FILENO)
+	{
+		if (r->saved[fd] == SAVED_CLOSED)
+			close(fd);
+		else if (r->saved[fd] >= 0)
+		{
+			if (dup2(r->saved[fd], fd) == -1)
+				print_error("dup2", strerror(errno));
+			close(r->saved[fd]);
+		}
+		r->saved[fd] = -1;
+		fd++;
+	}
+	return (pc + 1);
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_ops_spawn.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 21:40:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 01:40:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+#include <spawn.h>
+
+/*
+** A redirection target, opened by the shell for a spawned child. The
+** open must not block the shell while it has stages left to start, so
+** it is non-blocking; a fifo, whose open has to wait for its other end,
+** is left to a forked child.
+*/
+static int	spawn_open(t_redir *r)
+{
+	struct stat	st;
+	int			flags;
+	int			fd;
+
+	flags = O_RDONLY;
+	if (r->type == TOKEN_REDIR_OUT)
+		flags = O_WRONLY | O_CREAT | O_TRUNC;
+	else if (r->type == TOKEN_REDIR_APPEND)
+		flags = O_WRONLY | O_CREAT | O_APPEND;
+	fd = open(r->file, flags | O_NONBLOCK | O_CLOEXEC, 0644);
+	if (fd >= 0 && (fstat(fd, &st) == -1 || S_ISFIFO(st.st_mode)
+			|| fcntl(fd, F_SETFL, flags & O_APPEND) == -1))
+	{
+		close(fd);
+		return (-1);
+	}
+	return (fd);
+}
+
+/*
+** The redirections in order; returns the fds opened, -1 if one failed.
+** A heredoc's file is the shell's to close, after the line.
+*/
+static int	spawn_redirs(posix_spawn_file_actions_t *fa, t_redir *r, int *fds)
+{
+	int	n;
+	int	to;
+	int	fd;
+
+	n = 0;
+	while (r)
+	{
+		to = STDOUT_FILENO;
+		if (r->type == TOKEN_REDIR_IN || r->type == TOKEN_REDIR_HEREDOC)
+			to = STDIN_FILENO;
+		fd = r->fd;
+		if (r->type != TOKEN_REDIR_HEREDOC)
+			fd = spawn_open(r);
+		if (fd >= 0 && r->type != TOKEN_REDIR_HEREDOC)
+			fds[n++] = fd;
+		if (fd < 0 || posix_spawn_file_actions_adddup2(fa, fd, to) != 0)
+			break ;
+		r = r->next;
+	}
+	if (!r)
+		return (n);
+	while (n-- > 0)
+		close(fds[n]);
+	return (-1);
+}
+
+/*
+** What OP_STDIN and OP_STDOUT do for a forked child, before the
+** redirections. The pipe fds are close-on-exec, so there is nothing to
+** close; adddup2() of an fd onto itself clears the flag.
+*/
+static int	spawn_pipes(t_run *r, posix_spawn_file_actions_t *fa)
+{
+	int	ok;
+
+	ok = 1;
+	if (r->prev_rd >= 0)
+		ok = !posix_spawn_file_actions_adddup2(fa, r->prev_rd, STDIN_FILENO);
+	if (ok && r->pipe_wr >= 0)
+		ok = !posix_spawn_file_actions_adddup2(fa, r->pipe_wr, STDOUT_FILENO);
+	return (ok);
+}
+
+/* signals go back to their defaults in the child, as after OP_FORK */
+static int	spawn_start(t_run *r, t_instr *in, posix_spawn_file_actions_t *fa)
+{
+	posix_spawnattr_t	attr;
+	sigset_t			def;
+	pid_t				pid;
+	int					err;
+
+	if (posix_spawnattr_init(&attr) != 0)
+		return (0);
+	sigemptyset(&def);
+	sigaddset(&def, SIGINT);
+	sigaddset(&def, SIGQUIT);
+	posix_spawnattr_setsigdefault(&attr, &def);
+	posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGDEF);
+	err = posix_spawn(&pid, in->path, fa, &attr, in->cmd->args,
+			env_envp(r->shell->env));
+	posix_spawnattr_destroy(&attr);
+	if (err != 0)
+		return (0);
+	r->stages[in->b].pid = pid;
+	r->stages[in->b].start = stage_clock();
+	return (1);
+}
+
+/*
+** Start the program without copying the shell: posix_spawn() runs the
+** child on the shell's memory until it execs, so starting one costs
+** the same however big the shell has grown. Then carry on at a, as
+** the shell does after OP_FORK. Anything that goes wrong on the way
+** (a redirection, the lookup, the exec) falls through to OP_FORK,
+** whose child runs into the same error and reports it as it always
+** has.
+*/
+int	op_spawn(t_run *r, t_instr *in, int pc)
+{
+	posix_spawn_file_actions_t	fa;
+	int							fds[SPAWN_REDIRS];
+	int							n;
+	int							ok;
+
+	if (r->failed || !in->path || !env_envp(r->shell->env))
+		return (pc + 1);
+	if (posix_spawn_file_actions_init(&fa) != 0)
+		return (pc + 1);
+	n = -1;
+	if (spawn_pipes(r, &fa))
+		n = spawn_redirs(&fa, in->cmd->redirs, fds);
+	ok = n >= 0 && spawn_start(r, in, &fa);
+	posix_spawn_file_actions_destroy(&fa);
+	while (n-- > 0)
+		close(fds[n]);
+	if (!ok)
+		return (pc + 1);
+	return (in->a);
+}
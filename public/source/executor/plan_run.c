@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   plan_run.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:48:26 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 01:05:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static int	step_cmd(t_run *r, t_instr *in, int pc)
+{
+	if (in->op == OP_STDIN || in->op == OP_STDOUT)
+		return (op_stdio(r, in, pc));
+	if (in->op == OP_REDIR)
+		return (op_redir(r, in, pc));
+	if (in->op == OP_SAVE)
+		return (op_save(r, in, pc));
+	if (in->op == OP_RESTORE)
+		return (op_restore(r, in, pc));
+	if (in->op == OP_BUILTIN)
+		return (op_builtin(r, in, pc));
+	if (in->op == OP_RESOLVE)
+		return (op_resolve(r, in, pc));
+	if (in->op == OP_EXEC)
+		return (op_exec(r, in, pc));
+	if (in->op == OP_EXIT)
+		exit(r->shell->exit_status);
+	if (in->op == OP_STATUS)
+		r->shell->exit_status = in->a;
+	return (pc + 1);
+}
+
+static int	step(t_run *r, t_instr *in, int pc)
+{
+	if (in->op == OP_PIPE)
+		return (op_pipe(r, in, pc));
+	if (in->op == OP_FORK)
+		return (op_fork(r, in, pc));
+	if (in->op == OP_SPAWN)
+		return (op_spawn(r, in, pc));
+	if (in->op == OP_NEXT)
+		return (op_next(r, in, pc));
+	if (in->op == OP_WAIT)
+		return (op_wait(r, in, pc));
+	return (step_cmd(r, in, pc));
+}
+
+/*
+** Run a plan from plan_compile(). Children leave through OP_EXIT, so
+** only the shell ever reaches OP_END, where it keeps the stages the
+** plan reaped, if it reaped any.
+*/
+void	plan_run(t_plan *plan, t_shell *shell)
+{
+	t_run	r;
+	int		pc;
+
+	ft_bzero(&r, sizeof(r));
+	r.shell = shell;
+	r.prev_rd = -1;
+	r.pipe_rd = -1;
+	r.pipe_wr = -1;
+	r.saved[0] = -1;
+	r.saved[1] = -1;
+	r.stages = arena_alloc(&g_shell.arena,
+			sizeof(t_stage) * (plan->slots + 1));
+	if (!r.stages)
+		return ;
+	ft_bzero(r.stages, sizeof(t_stage) * (plan->slots + 1));
+	pc = 0;
+	while (plan->code[pc].op != OP_END)
+		pc = step(&r, &plan->code[pc], pc);
+	stages_keep(&shell->stages, r.stages, plan->slots * r.reaped,
+		shell->exit_status);
+}
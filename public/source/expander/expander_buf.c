@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_buf.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 18:10:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 19:02:45 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** Make room for n more bytes and the terminator. The result doubles
+** (or jumps straight to what is needed), so a word costs its expanded
+** size at most twice over, however long the values in it are.
+*/
+int	exp_reserve(t_exp_ctx *c, size_t n)
+{
+	size_t	cap;
+	char	*res;
+
+	if ((size_t)c->j + n + 1 <= c->cap)
+		return (1);
+	cap = c->cap * 2;
+	if (cap < (size_t)c->j + n + 1)
+		cap = (size_t)c->j + n + 1;
+	res = arena_grow(&g_shell.arena, c->result, c->cap, cap);
+	if (!res)
+		return (0);
+	c->result = res;
+	c->cap = cap;
+	return (1);
+}
+
+int	exp_append(t_exp_ctx *c, const char *s, size_t n)
+{
+	if (!exp_reserve(c, n))
+		return (0);
+	ft_memcpy(c->result + c->j, s, n);
+	c->j += n;
+	return (1);
+}
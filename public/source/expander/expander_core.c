@@ -6,73 +6,85 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/04 15:10:00 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/06 15:23:36 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/18 12:30:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
 /* forward decl only; real body is in expander_utils.c */
-void	process_dollar(t_exp_ctx *c);
+int		process_dollar(t_exp_ctx *c);
 
-/* Helper: check if current character is a quote */
-static int	is_ctx_quote(t_exp_ctx *c)
+/*
+** The result starts at the word's own size, which is enough unless a
+** variable expands to something longer; exp_reserve() grows it from
+** there. Only words of the line are unquoted: their quotes are known
+** from the line's mask.
+*/
+static int	init_ctx(t_exp_ctx *c, char *s, int unquote)
 {
-	char	ch;
-
-	ch = c->str[c->i];
-	return (ch == '\'' || ch == '"');
-}
-
-static int	init_ctx(t_exp_ctx *c, char *s, t_env *env, int st)
-{
-	size_t	cap;
-
-	if (!s)
-		return (0);
 	c->str = s;
-	c->env = env;
-	c->exit_status = st;
-	c->in_quote = 0;
+	c->base = line_offset(s);
+	c->unquote = unquote && c->base >= 0;
 	c->i = 0;
 	c->j = 0;
-	cap = ft_strlen(s) * 10 + 4096;
-	c->result = malloc(cap);
-	if (!c->result)
-		return (0);
+	c->cap = ft_strlen(s) + 1;
+	c->result = arena_alloc(&g_shell.arena, c->cap);
 	return (c->result != NULL);
 }
 
-/* Helper: handle quote toggling during expansion */
-static void	handle_quote(t_exp_ctx *c)
+/*
+** Copy the word up to the next '$' (the first byte may be a literal
+** one), leaving out the quotes and backslashes when unquoting.
+*/
+static int	copy_run(t_exp_ctx *c)
 {
-	if (!c->in_quote)
-		c->in_quote = c->str[c->i];
-	else if (c->in_quote == c->str[c->i])
-		c->in_quote = 0;
-	c->result[c->j++] = c->str[c->i++];
+	size_t	n;
+
+	n = 1;
+	while (c->str[c->i + n] && c->str[c->i + n] != '$')
+		n++;
+	if (c->unquote)
+		return (append_kept(c, n));
+	if (!exp_append(c, c->str + c->i, n))
+		return (0);
+	c->i += n;
+	return (1);
 }
 
-static int	should_expand(t_exp_ctx *c)
+/* c->str from c->i on, appended to what c->result already holds */
+int	exp_run(t_exp_ctx *c)
 {
-	return (c->str[c->i] == '$' && c->in_quote != '\'');
+	int	ok;
+
+	ok = 1;
+	while (ok && c->str[c->i])
+	{
+		if (c->str[c->i] == '$' && !dollar_is_literal(c))
+			ok = process_dollar(c);
+		else
+			ok = copy_run(c);
+	}
+	return (ok);
 }
 
-char	*expand_variables(char *str, t_env *env, int exit_status)
+/*
+** Expand $NAME and $? in str and, with unquote, remove its quotes in
+** the same pass. Quotes and backslashes come out where the line's mask
+** drops them, so the ones a variable's value brings in stay. The result
+** is shrunk to its final size.
+*/
+char	*expand_word(char *str, t_env *env, int st, int unquote)
 {
 	t_exp_ctx	c;
 
-	if (!init_ctx(&c, str, env, exit_status))
+	if (!str || !init_ctx(&c, str, unquote))
+		return (NULL);
+	c.env = env;
+	c.exit_status = st;
+	if (!exp_run(&c))
 		return (NULL);
-	while (str[c.i])
-	{
-		if (is_ctx_quote(&c))
-			handle_quote(&c);
-		else if (should_expand(&c))
-			process_dollar(&c);
-		else
-			c.result[c.j++] = c.str[c.i++];
-	}
 	c.result[c.j] = '\0';
+	arena_shrink(&g_shell.arena, c.result, (size_t)c.j + 1);
 	return (c.result);
 }
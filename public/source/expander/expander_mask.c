@@ -0,0 +1,78 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   expander_mask.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:12:40 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 19:02:45 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** A '$' is kept as it is inside single quotes and behind an active
+** backslash, which is what the line's dol set leaves out. Strings that
+** are not part of the line (heredoc bodies) have no quote mask; there
+** only the backslash counts.
+*/
+int	dollar_is_literal(t_exp_ctx *c)
+{
+	if (c->base < 0)
+		return (c->i > 0 && c->str[c->i - 1] == '\\');
+	return (!qm_bit(g_shell.line.qm.dol, (size_t)c->base + c->i));
+}
+
+/*
+** Append the word bytes [c->i, c->i + n) that quote removal keeps: the
+** stretches between the bits of the line's drop set, one copy each.
+*/
+int	append_kept(t_exp_ctx *c, size_t n)
+{
+	const uint64_t	*drop;
+	size_t			at;
+	size_t			end;
+	size_t			cut;
+
+	drop = g_shell.line.qm.drop;
+	at = (size_t)c->base + c->i;
+	end = at + n;
+	while (at < end)
+	{
+		cut = qm_next(drop, at, end);
+		if (!exp_append(c, c->str + (at - c->base), cut - at))
+			return (0);
+		at = cut + 1;
+	}
+	c->i += n;
+	return (1);
+}
+
+/*
+** Whether the word of the line starting at at reaches its end (a stop
+** byte, or the end of the line) before an expanding '$' or a byte that
+** quote removal drops. Whole mask words are compared, so a word costs
+** one or two iterations and its length is never measured.
+*/
+int	word_is_plain(size_t at)
+{
+	const t_qmask	*qm;
+	size_t			b;
+	uint64_t		stop;
+	uint64_t		work;
+
+	qm = &g_shell.line.qm;
+	b = at / 64;
+	stop = qm->stop[b] & (~(uint64_t)0 << (at & 63));
+	work = (qm->dol[b] | qm->drop[b]) & (~(uint64_t)0 << (at & 63));
+	while (!stop && !work && ++b <= g_shell.line.len / 64)
+	{
+		stop = qm->stop[b];
+		work = qm->dol[b] | qm->drop[b];
+	}
+	if (!work)
+		return (1);
+	return (stop && __builtin_ctzll(stop) < __builtin_ctzll(work));
+}
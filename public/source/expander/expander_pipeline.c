@@ -6,17 +6,24 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/04 15:10:00 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/04 15:10:00 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 23:40:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
+/*
+** A heredoc delimiter is never expanded, only unquoted by the heredoc;
+** its body is, when it has a $ and the delimiter had no quotes.
+*/
 void	expand_redirections(t_redir *redir, t_env *env, int exit_status)
 {
 	while (redir)
 	{
-		expand_arg(&redir->file, env, exit_status);
+		if (redir->type != TOKEN_REDIR_HEREDOC)
+			expand_arg(&redir->file, env, exit_status);
+		else if (redir->expand)
+			heredoc_expand(redir);
 		redir = redir->next;
 	}
 }
@@ -38,12 +45,3 @@ void	expand_pipeline_cmds(t_cmd *cmds, t_env *env, int exit_status)
 		cmds = cmds->next;
 	}
 }
-
-void	expander(t_pipeline *pipeline, t_env *env)
-{
-	while (pipeline)
-	{
-		expand_pipeline_cmds(pipeline->cmds, env, g_shell.exit_status);
-		pipeline = pipeline->next;
-	}
-}
@@ -6,89 +6,32 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/04 15:10:00 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/06 15:23:36 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 15:40:12 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
-static int	is_quote_char(char ch)
+/*
+** Take out the bytes whose bit is set in drop (s[k] is bit base + k):
+** the quotes and active backslashes the line's quote mask found. One
+** bit test per byte and no quote state; the word shrinks in place.
+*/
+char	*remove_quotes(char *s, const uint64_t *drop, size_t base)
 {
-	return (ch == '\'' || ch == '"');
-}
-
-static int	handle_quote(t_quote_ctx *c, char *s)
-{
-	if (!c->quote && is_quote_char(s[c->i]))
-	{
-		c->quote = s[c->i++];
-		return (1);
-	}
-	if (c->quote && s[c->i] == c->quote)
-	{
-		c->quote = 0;
-		c->i++;
-		return (1);
-	}
-	return (0);
-}
-
-static void	handle_bs_outside(t_quote_ctx *c, char *s)
-{
-	if (s[c->i] == '\\' && !c->quote && s[c->i + 1])
-	{
-		c->res[c->j++] = s[c->i + 1];
-		c->i += 2;
-	}
-	else
-	{
-		c->res[c->j++] = s[c->i++];
-	}
-}
-
-static void	handle_bs_in_dq(t_quote_ctx *c, char *s)
-{
-	if (s[c->i] == '\\' && c->quote == '"' && s[c->i + 1])
-	{
-		if (s[c->i + 1] == '"' || s[c->i + 1] == '$'
-			|| s[c->i + 1] == '\\')
-		{
-			c->res[c->j++] = s[c->i + 1];
-			c->i += 2;
-		}
-		else
-		{
-			c->res[c->j++] = s[c->i++];
-		}
-	}
-	else
-		handle_bs_outside(c, s);
-}
-
-char	*remove_quotes(char *s)
-{
-	t_quote_ctx	c;
-	char		*res;
+	size_t	i;
+	size_t	j;
 
-	if (!s)
-		return (NULL);
-	c.i = 0;
-	c.j = 0;
-	c.quote = 0;
-	c.str = s;
-	res = malloc(ft_strlen(s) + 1);
-	if (!res)
-		return (NULL);
-	c.res = res;
-	while (s[c.i])
+	if (!s || !drop)
+		return (s);
+	i = 0;
+	j = 0;
+	while (s[i])
 	{
-		if (handle_quote(&c, s))
-			continue ;
-		if (s[c.i] == '\\')
-			handle_bs_in_dq(&c, s);
-		else
-			c.res[c.j++] = s[c.i++];
+		if (!((drop[(base + i) / 64] >> ((base + i) & 63)) & 1))
+			s[j++] = s[i];
+		i++;
 	}
-	c.res[c.j] = '\0';
-	return (res);
+	s[j] = '\0';
+	return (s);
 }
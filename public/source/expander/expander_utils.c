@@ -6,57 +6,59 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/04 15:10:00 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/06 15:23:36 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 19:02:45 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
-void	process_dollar(t_exp_ctx *c)
+int	process_dollar(t_exp_ctx *c)
 {
-	if (c->i > 0 && c->str[c->i - 1] == '\\' && c->in_quote != '\'')
-	{
-		c->result[c->j++] = c->str[c->i++];
-		return ;
-	}
-	if (c->in_quote == '\'')
-	{
-		c->result[c->j++] = c->str[c->i++];
-		return ;
-	}
 	c->i++;
 	if (c->str[c->i] == '?')
 	{
-		expand_exit_status(c->result, &c->j, c->exit_status);
 		c->i++;
-		return ;
+		return (expand_exit_status(c));
 	}
-	expand_var_name(c);
+	return (expand_var_name(c));
 }
 
-void	expand_arg(char **arg, t_env *env, int exit_status)
+static int	has_special(const char *s)
 {
-	char	*expanded;
-	char	*unquoted;
-
-	expanded = expand_variables(*arg, env, exit_status);
-	unquoted = remove_quotes(expanded);
-	free(*arg);
-	free(expanded);
-	*arg = unquoted;
+	while (*s)
+	{
+		if (*s == '$' || *s == '\'' || *s == '"' || *s == '\\')
+			return (1);
+		s++;
+	}
+	return (0);
 }
 
-int			get_non_empty_arg_count(char **args);
-char		**get_allocated_compact_args(char **args, int cnt);
+/*
+** Words without an expanding $ and without quotes or backslashes to
+** remove stay as spans of the line. A word of the line is checked
+** against the quote mask the lexer already built (word_is_plain());
+** anything else is looked at byte by byte.
+*/
+static int	needs_expansion(const char *s)
+{
+	long	base;
 
-static char	**compact_args(char **args)
+	base = line_offset(s);
+	if (base < 0)
+		return (has_special(s));
+	return (!word_is_plain((size_t)base));
+}
+
+void	expand_arg(char **arg, t_env *env, int exit_status)
 {
-	int	cnt;
+	char	*expanded;
 
-	if (!args)
-		return (NULL);
-	cnt = get_non_empty_arg_count(args);
-	return (get_allocated_compact_args(args, cnt));
+	if (!*arg || !needs_expansion(*arg))
+		return ;
+	expanded = expand_word(*arg, env, exit_status, 1);
+	if (expanded)
+		*arg = expanded;
 }
 
 void	expand_cmd_args(t_cmd *cmd, t_env *env, int exit_status)
@@ -69,5 +71,5 @@ void	expand_cmd_args(t_cmd *cmd, t_env *env, int exit_status)
 		expand_arg(&cmd->args[i], env, exit_status);
 		i++;
 	}
-	cmd->args = compact_args(cmd->args);
+	compact_args(cmd->args);
 }
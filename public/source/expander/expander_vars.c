@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/04 15:10:00 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/06 15:23:36 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/18 10:15:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,37 +14,72 @@
 
 char	*get_env_value(t_env *env, char *key)
 {
-	while (env)
+	t_var	*var;
+
+	var = env_find(env, key);
+	if (!var)
+		return (NULL);
+	return (var->value);
+}
+
+/* a number is written straight into the result, no string is made */
+static int	exp_append_num(t_exp_ctx *c, int num)
+{
+	char			digits[12];
+	int				k;
+	unsigned int	n;
+
+	n = (unsigned int)num;
+	if (num < 0)
+		n = -n;
+	k = 12;
+	digits[--k] = '0' + n % 10;
+	while (n / 10)
 	{
-		if (ft_strcmp(env->key, key) == 0)
-			return (env->value);
-		env = env->next;
+		n /= 10;
+		digits[--k] = '0' + n % 10;
 	}
-	return (NULL);
+	if (num < 0)
+		digits[--k] = '-';
+	return (exp_append(c, digits + k, 12 - k));
+}
+
+int	expand_exit_status(t_exp_ctx *c)
+{
+	return (exp_append_num(c, c->exit_status));
 }
 
-void	expand_exit_status(char *result, int *j, int exit_status)
+/*
+** $PIPESTATUS: the status of every stage of the last pipeline, with a
+** space between them. There are no arrays to put them in, so this is
+** bash's "${PIPESTATUS[*]}" rather than its $PIPESTATUS. Like $? it is
+** the shell's own: a PIPESTATUS in the environment is never read here,
+** though the programs the shell starts still inherit it.
+*/
+static int	expand_pipestatus(t_exp_ctx *c)
 {
-	char	*tmp;
-	int		len;
+	int	i;
 
-	if (!result || !j)
-		return ;
-	tmp = ft_itoa(exit_status);
-	if (!tmp)
-		return ;
-	len = ft_strlen(tmp);
-	ft_strcpy(&result[*j], tmp);
-	*j += len;
-	free(tmp);
+	i = 0;
+	while (i < g_shell.stages.n)
+	{
+		if (i > 0 && !exp_append(c, " ", 1))
+			return (0);
+		if (!exp_append_num(c, g_shell.stages.v[i].status))
+			return (0);
+		i++;
+	}
+	return (1);
 }
 
 /* reads name at c->str[c->i], appends value (or nothing) into c->result,
-   and advances c->i past the name, updates c->j accordingly */
-void	expand_var_name(t_exp_ctx *ctx)
+   and advances c->i past the name, updates c->j accordingly.
+   The name is looked up in place by briefly terminating it, so no key
+   string is allocated. */
+int	expand_var_name(t_exp_ctx *ctx)
 {
 	int		start;
-	char	*key;
+	char	saved;
 	char	*val;
 
 	start = ctx->i;
@@ -52,14 +87,15 @@ void	expand_var_name(t_exp_ctx *ctx)
 		|| ctx->str[ctx->i] == '_')
 		ctx->i++;
 	if (ctx->i == start)
-	{
-		ctx->result[ctx->j++] = '$';
-		return ;
-	}
-	key = ft_substr(ctx->str, start, ctx->i - start);
-	val = get_env_value(ctx->env, key);
-	if (val)
-		while (*val)
-			ctx->result[ctx->j++] = *val++;
-	free(key);
+		return (exp_append(ctx, "$", 1));
+	if (ctx->i - start == 10
+		&& ft_strncmp(ctx->str + start, "PIPESTATUS", 10) == 0)
+		return (expand_pipestatus(ctx));
+	saved = ctx->str[ctx->i];
+	ctx->str[ctx->i] = '\0';
+	val = get_env_value(ctx->env, ctx->str + start);
+	ctx->str[ctx->i] = saved;
+	if (!val)
+		return (1);
+	return (exp_append(ctx, val, ft_strlen(val)));
 }
@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_hash.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:20:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 23:10:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/* right-aligned in four columns, as bash prints them */
+static void	put_hits(int n)
+{
+	int	width;
+	int	m;
+
+	width = 1;
+	m = n;
+	while (m >= 10)
+	{
+		m /= 10;
+		width++;
+	}
+	while (width++ < 4)
+		ft_putchar_fd(' ', 1);
+	ft_putnbr_fd(n, 1);
+}
+
+static void	hash_list(t_cmdhash *h)
+{
+	size_t	i;
+
+	if (!h->count)
+	{
+		ft_putendl_fd("hash: hash table empty", 1);
+		return ;
+	}
+	ft_putendl_fd("hits\tcommand", 1);
+	i = 0;
+	while (i < h->cap)
+	{
+		if (h->slots[i] && h->slots[i]->path)
+		{
+			put_hits(h->slots[i]->hits);
+			ft_putchar_fd('\t', 1);
+			ft_putendl_fd(h->slots[i]->path, 1);
+		}
+		i++;
+	}
+}
+
+/*
+** -p pathname name...: each name runs pathname, no questions asked.
+** Any other option is a usage error.
+*/
+static int	hash_pin(t_cmdhash *h, char **args)
+{
+	t_hashed	*e;
+	int			i;
+
+	if (ft_strcmp(args[0], "-p") != 0 || !args[1] || !args[2])
+	{
+		print_error("hash", "usage: hash [-r] [-p pathname] [name ...]");
+		return (2);
+	}
+	i = 2;
+	while (args[i])
+	{
+		e = hash_put(h, args[i], args[1]);
+		if (!e)
+			return (1);
+		e->pinned = 1;
+		i++;
+	}
+	return (0);
+}
+
+/* hash name: look it up again now, whatever was remembered */
+static int	hash_add(t_cmdhash *h, char *name)
+{
+	char	*found;
+	int		ok;
+
+	if (ft_strchr(name, '/'))
+		return (0);
+	found = hash_search(h, name);
+	if (!found)
+	{
+		ft_putstr_fd("minishell: hash: ", 2);
+		ft_putstr_fd(name, 2);
+		ft_putendl_fd(": not found", 2);
+		return (1);
+	}
+	ok = hash_put(h, name, found) != NULL;
+	free(found);
+	return (!ok);
+}
+
+/*
+** hash [-r] [-p pathname] [name ...]
+** With no arguments, lists what is remembered and how often it was used.
+** -r forgets everything first, down to the PATH directories it keeps
+** open; -p remembers pathname for the names.
+*/
+int	builtin_hash(char **args, t_shell *shell)
+{
+	int		status;
+	int		i;
+
+	i = 1;
+	while (args[i] && ft_strcmp(args[i], "-r") == 0)
+	{
+		hash_destroy(&shell->hash);
+		i++;
+	}
+	hash_sync(&shell->hash, shell->env);
+	if (!args[1])
+		hash_list(&shell->hash);
+	if (args[i] && args[i][0] == '-' && args[i][1])
+		return (hash_pin(&shell->hash, args + i));
+	status = 0;
+	while (args[i])
+	{
+		status |= hash_add(&shell->hash, args[i]);
+		i++;
+	}
+	return (status);
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:20:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 23:10:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef HASH_H
+# define HASH_H
+
+# include <stddef.h>
+# include <stdint.h>
+
+/*
+** The command hash: where each program name run so far was found in
+** PATH, as bash keeps it. A name is searched in PATH once; after that
+** a lookup costs one hash and one fstatat() of the remembered file. An
+** entry whose file is gone or no longer executable is searched again.
+** Entries made with hash -p are pinned: taken as they are, checked by
+** nobody but execve().
+**
+** The table is the same open-addressing scheme as the environment's
+** (see env.h), minus removal: entries are only ever added or changed,
+** and all dropped at once by hash -r or when PATH is no longer the
+** value path_env kept of it.
+**
+** The directories of that PATH are opened once, as O_PATH fds, so a
+** search probes each of them with one fstatat() and builds no string
+** until it has a hit. dirbuf is path_env cut into its directories.
+** A relative directory (an empty one is ".") is opened at each search,
+** since it depends on where the shell is; one that could not be opened
+** is tried again at each search until it can.
+*/
+# define HASH_INIT	64
+
+typedef struct s_pathdir
+{
+	char	*dir;
+	int		fd;
+	int		rel;
+}	t_pathdir;
+
+typedef struct s_hashed
+{
+	char		*name;
+	char		*path;
+	uint64_t	hash;
+	int			hits;
+	int			pinned;
+}	t_hashed;
+
+typedef struct s_cmdhash
+{
+	t_hashed	**slots;
+	size_t		cap;
+	size_t		count;
+	char		*path_env;
+	char		*dirbuf;
+	t_pathdir	*dirs;
+	size_t		ndirs;
+}	t_cmdhash;
+
+t_hashed	*hash_find(t_cmdhash *h, const char *name);
+t_hashed	*hash_put(t_cmdhash *h, const char *name, const char *path);
+void		hash_clear(t_cmdhash *h);
+void		hash_destroy(t_cmdhash *h);
+void		hash_sync(t_cmdhash *h, t_env *env);
+char		*hash_lookup(t_cmdhash *h, const char *name, t_env *env);
+int			hash_open_dirs(t_cmdhash *h);
+void		hash_close_dirs(t_cmdhash *h);
+int			hash_probe(int dir, const char *name);
+char		*hash_search(t_cmdhash *h, const char *name);
+
+#endif
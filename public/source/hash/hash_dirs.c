@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_dirs.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:05:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 23:10:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static size_t	count_dirs(const char *path)
+{
+	size_t	n;
+
+	n = 1;
+	while (*path)
+	{
+		if (*path == ':')
+			n++;
+		path++;
+	}
+	return (n);
+}
+
+/* the directory *s starts, cut off the rest of PATH; an empty one is "." */
+static char	*cut_dir(char **s)
+{
+	char	*dir;
+
+	dir = *s;
+	while (**s && **s != ':')
+		(*s)++;
+	if (**s)
+		*(*s)++ = '\0';
+	if (!*dir)
+		return (".");
+	return (dir);
+}
+
+/*
+** Cut the copy of PATH into its directories and open the absolute
+** ones. Returns 0 when out of memory, leaving no directory to search.
+*/
+int	hash_open_dirs(t_cmdhash *h)
+{
+	t_pathdir	*d;
+	char		*s;
+	size_t		n;
+
+	n = count_dirs(h->path_env);
+	h->dirbuf = ft_strdup(h->path_env);
+	h->dirs = ft_calloc(n, sizeof(t_pathdir));
+	if (!h->dirbuf || !h->dirs)
+	{
+		hash_close_dirs(h);
+		return (0);
+	}
+	s = h->dirbuf;
+	while (h->ndirs < n)
+	{
+		d = &h->dirs[h->ndirs++];
+		d->dir = cut_dir(&s);
+		d->rel = d->dir[0] != '/';
+		d->fd = -1;
+		if (!d->rel)
+			d->fd = open(d->dir, O_PATH | O_DIRECTORY | O_CLOEXEC);
+	}
+	return (1);
+}
+
+void	hash_close_dirs(t_cmdhash *h)
+{
+	while (h->ndirs > 0)
+	{
+		h->ndirs--;
+		if (h->dirs[h->ndirs].fd >= 0)
+			close(h->dirs[h->ndirs].fd);
+	}
+	free(h->dirs);
+	free(h->dirbuf);
+	h->dirs = NULL;
+	h->dirbuf = NULL;
+}
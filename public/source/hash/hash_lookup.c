@@ -0,0 +1,90 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_lookup.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:20:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 23:10:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/* hash -r: forget everything, keeping the slots for what comes next */
+void	hash_clear(t_cmdhash *h)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < h->cap)
+	{
+		if (h->slots[i])
+			free(h->slots[i]->path);
+		free(h->slots[i]);
+		h->slots[i] = NULL;
+		i++;
+	}
+	h->count = 0;
+}
+
+void	hash_destroy(t_cmdhash *h)
+{
+	hash_clear(h);
+	hash_close_dirs(h);
+	free(h->slots);
+	free(h->path_env);
+	ft_bzero(h, sizeof(*h));
+}
+
+/*
+** What was found in another PATH (or with none) is dropped, and the
+** directories of the new one are opened.
+*/
+void	hash_sync(t_cmdhash *h, t_env *env)
+{
+	char	*path;
+
+	path = get_env_value(env, "PATH");
+	if (path && h->path_env && ft_strcmp(path, h->path_env) == 0)
+		return ;
+	if (!path && !h->path_env)
+		return ;
+	hash_clear(h);
+	hash_close_dirs(h);
+	free(h->path_env);
+	h->path_env = NULL;
+	if (path)
+		h->path_env = ft_strdup(path);
+	if (h->path_env)
+		hash_open_dirs(h);
+}
+
+/*
+** Where name is in PATH, NULL when it is not. A remembered file is used
+** while it is still an executable one, anything else is searched for
+** and remembered. The string belongs to the table.
+*/
+char	*hash_lookup(t_cmdhash *h, const char *name, t_env *env)
+{
+	char		*found;
+	t_hashed	*e;
+
+	hash_sync(h, env);
+	e = hash_find(h, name);
+	if (e && e->path && (e->pinned || hash_probe(AT_FDCWD, e->path) == 2))
+	{
+		e->hits++;
+		return (e->path);
+	}
+	found = hash_search(h, name);
+	if (!found)
+		return (NULL);
+	e = hash_put(h, name, found);
+	free(found);
+	if (!e)
+		return (NULL);
+	e->hits = 1;
+	return (e->path);
+}
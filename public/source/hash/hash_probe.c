@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_probe.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 23:05:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 23:10:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** What name is in dir: 2 for a regular file we may run, 1 for anything
+** else there but a directory, 0 for nothing usable. One fstatat(); a
+** faccessat() only when the mode bits cannot tell, for a file someone
+** else owns with some but not all of its execute bits set.
+*/
+int	hash_probe(int dir, const char *name)
+{
+	struct stat	st;
+	uid_t		uid;
+
+	if (fstatat(dir, name, &st, 0) == -1 || S_ISDIR(st.st_mode))
+		return (0);
+	if (!S_ISREG(st.st_mode) || !(st.st_mode & 0111))
+		return (1);
+	uid = geteuid();
+	if (uid == 0 || (st.st_mode & 0111) == 0111)
+		return (2);
+	if (st.st_uid == uid)
+		return (1 + ((st.st_mode & S_IXUSR) != 0));
+	if (faccessat(dir, name, X_OK, AT_EACCESS) == 0)
+		return (2);
+	return (1);
+}
+
+/* a directory that is not kept open is opened for this one probe */
+static int	dir_probe(t_pathdir *d, const char *name)
+{
+	int	fd;
+	int	found;
+
+	if (d->fd >= 0)
+		return (hash_probe(d->fd, name));
+	fd = open(d->dir, O_PATH | O_DIRECTORY | O_CLOEXEC);
+	if (fd < 0)
+		return (0);
+	found = hash_probe(fd, name);
+	if (d->rel)
+		close(fd);
+	else
+		d->fd = fd;
+	return (found);
+}
+
+static char	*dir_join(const char *dir, const char *name)
+{
+	size_t	a;
+	size_t	b;
+	char	*s;
+
+	a = ft_strlen(dir);
+	b = ft_strlen(name);
+	s = malloc(a + b + 2);
+	if (!s)
+		return (NULL);
+	ft_memcpy(s, dir, a);
+	s[a] = '/';
+	ft_memcpy(s + a + 1, name, b + 1);
+	return (s);
+}
+
+/*
+** Search PATH for name: the first regular file we may run, else the
+** first thing of that name that is not a directory, so that running
+** it says why it cannot be run. Returns dir/name, malloc'd, or NULL.
+*/
+char	*hash_search(t_cmdhash *h, const char *name)
+{
+	t_pathdir	*other;
+	size_t		i;
+	int			found;
+
+	other = NULL;
+	i = 0;
+	while (i < h->ndirs)
+	{
+		found = dir_probe(&h->dirs[i], name);
+		if (found == 2)
+			return (dir_join(h->dirs[i].dir, name));
+		if (found == 1 && !other)
+			other = &h->dirs[i];
+		i++;
+	}
+	if (!other)
+		return (NULL);
+	return (dir_join(other->dir, name));
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash_table.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 22:20:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 22:41:30 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/* the slot that holds name, or the empty one that ends its run */
+static size_t	hash_slot(t_cmdhash *h, const char *name, uint64_t hv)
+{
+	size_t	mask;
+	size_t	i;
+
+	mask = h->cap - 1;
+	i = hv & mask;
+	while (h->slots[i] && (h->slots[i]->hash != hv
+			|| ft_strcmp(h->slots[i]->name, name) != 0))
+		i = (i + 1) & mask;
+	return (i);
+}
+
+t_hashed	*hash_find(t_cmdhash *h, const char *name)
+{
+	if (!h->cap)
+		return (NULL);
+	return (h->slots[hash_slot(h, name, env_hash(name))]);
+}
+
+/* put every entry into slots, walking the old ones */
+static void	hash_rehash(t_cmdhash *h, t_hashed **slots, size_t cap)
+{
+	size_t	i;
+	size_t	j;
+
+	i = 0;
+	while (i < h->cap)
+	{
+		if (h->slots[i])
+		{
+			j = h->slots[i]->hash & (cap - 1);
+			while (slots[j])
+				j = (j + 1) & (cap - 1);
+			slots[j] = h->slots[i];
+		}
+		i++;
+	}
+}
+
+/* room for one more entry: the table is kept at most half full */
+static int	hash_grow(t_cmdhash *h)
+{
+	t_hashed	**slots;
+	size_t		cap;
+
+	if ((h->count + 1) * 2 <= h->cap)
+		return (1);
+	cap = h->cap * 2;
+	if (cap < HASH_INIT)
+		cap = HASH_INIT;
+	slots = ft_calloc(cap, sizeof(t_hashed *));
+	if (!slots)
+		return (0);
+	hash_rehash(h, slots, cap);
+	free(h->slots);
+	h->slots = slots;
+	h->cap = cap;
+	return (1);
+}
+
+/*
+** Remember path for name, with no hits yet. The entry is made (one
+** block, with its name) the first time; after that only its path
+** changes. Returns NULL when out of memory; an entry that was left
+** without a path then counts as missing.
+*/
+t_hashed	*hash_put(t_cmdhash *h, const char *name, const char *path)
+{
+	t_hashed	*e;
+	size_t		len;
+
+	e = hash_find(h, name);
+	if (!e && hash_grow(h))
+	{
+		len = ft_strlen(name);
+		e = ft_calloc(1, sizeof(t_hashed) + len + 1);
+		if (!e)
+			return (NULL);
+		e->name = ft_memcpy(e + 1, name, len);
+		e->hash = env_hash(name);
+		h->slots[hash_slot(h, name, e->hash)] = e;
+		h->count++;
+	}
+	if (!e)
+		return (NULL);
+	free(e->path);
+	e->path = ft_strdup(path);
+	e->hits = 0;
+	e->pinned = 0;
+	if (!e->path)
+		return (NULL);
+	return (e);
+}
@@ -6,90 +6,109 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/03 11:55:37 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 14:38:44 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
-t_token	*create_token(t_token_type type, char *value)
+/* keep room for one more token plus the EOF sentinel */
+static int	tv_reserve(t_tokvec *tv)
 {
-	t_token	*token;
+	t_tok	*data;
+	size_t	cap;
 
-	token = malloc(sizeof(t_token));
-	if (!token)
-		return (NULL);
-	token->type = type;
-	if (value)
-		token->value = ft_strdup(value);
-	else
-		token->value = NULL;
-	token->next = NULL;
-	return (token);
+	if (tv->len + 1 < tv->cap)
+		return (1);
+	cap = tv->cap * 2;
+	data = arena_grow(&g_shell.arena, tv->data,
+			sizeof(t_tok) * tv->cap, sizeof(t_tok) * cap);
+	if (!data)
+		return (0);
+	tv->data = data;
+	tv->cap = cap;
+	return (1);
 }
 
-void	add_token(t_token **tokens, t_token *new_token)
+int	tv_push(t_tokvec *tv, t_token_type type, size_t off, size_t len)
 {
-	t_token	*current;
-
-	if (!*tokens)
-	{
-		*tokens = new_token;
-		return ;
-	}
-	current = *tokens;
-	while (current->next)
-		current = current->next;
-	current->next = new_token;
+	if (!tv_reserve(tv))
+		return (0);
+	tv->data[tv->len].type = type;
+	tv->data[tv->len].off = off;
+	tv->data[tv->len].len = len;
+	tv->len++;
+	return (1);
 }
 
-void	free_tokens(t_token *tokens)
+/*
+** Returns 1 to keep going, 0 to stop (end of input or a lone '&'),
+** -1 on allocation failure.
+*/
+static int	next_token(t_line *ln, size_t *i)
 {
-	t_token	*tmp;
+	t_tok	op;
+	size_t	len;
 
-	while (tokens)
+	while (is_whitespace(ln->buf[*i]))
+		(*i)++;
+	if (!ln->buf[*i])
+		return (0);
+	if (is_operator(ln->buf[*i]))
+	{
+		if (!get_operator_token(ln->buf + *i, &op))
+			return (0);
+		len = op.len;
+		if (!tv_push(&ln->tokens, op.type, *i, len))
+			return (-1);
+	}
+	else
 	{
-		tmp = tokens;
-		tokens = tokens->next;
-		free(tmp->value);
-		free(tmp);
+		len = measure_word(ln, *i);
+		if (!tv_push(&ln->tokens, TOKEN_WORD, *i, len))
+			return (-1);
 	}
+	*i += len;
+	return (1);
 }
 
-static t_token	*next_token(char **input)
+/*
+** Lex from byte i to the end of ln->buf and close the vector with the
+** EOF sentinel.
+*/
+int	lexer_run(t_line *ln, size_t i)
 {
-	t_token	*new_token;
-	char	*word;
-	int		len;
+	t_tokvec	*tv;
+	int			ret;
 
-	while (is_whitespace(**input))
-		(*input)++;
-	if (!**input)
-		return (NULL);
-	if (is_operator(**input))
-		new_token = get_operator_token(input);
-	else
-	{
-		len = extract_word(*input, &word);
-		new_token = create_token(TOKEN_WORD, word);
-		free(word);
-		*input += len;
-	}
-	return (new_token);
+	tv = &ln->tokens;
+	tv->line = ln->buf;
+	ret = 1;
+	while (ret > 0)
+		ret = next_token(ln, &i);
+	if (ret < 0)
+		return (0);
+	tv->data[tv->len].type = TOKEN_EOF;
+	tv->data[tv->len].off = i;
+	tv->data[tv->len].len = 0;
+	return (1);
 }
 
-t_token	*lexer(char *input)
+/*
+** Split ln->buf into a token vector and record the quote/escape state
+** at its end in the same pass. The first guess of one token per eight
+** bytes covers typical command lines, so long generated lines are lexed
+** with a single arena block that grows in place.
+*/
+int	lexer(t_line *ln)
 {
-	t_token	*tokens;
-	t_token	*new_token;
+	t_tokvec	*tv;
 
-	tokens = NULL;
-	while (*input)
-	{
-		new_token = next_token(&input);
-		if (!new_token)
-			break ;
-		add_token(&tokens, new_token);
-	}
-	return (tokens);
+	tv = &ln->tokens;
+	tv->len = 0;
+	tv->cap = ln->len / 8 + 16;
+	tv->data = arena_alloc(&g_shell.arena, sizeof(t_tok) * tv->cap);
+	if (!tv->data)
+		return (0);
+	return (lexer_run(ln, 0));
 }
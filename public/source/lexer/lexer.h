@@ -0,0 +1,172 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 18:41:10 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef LEXER_H
+# define LEXER_H
+
+# include <stddef.h>
+# include <stdint.h>
+
+/*
+** A token is a span of the input line: (type, offset, length).
+** Words are not copied; the parser terminates them in place when it
+** takes them (see tok_word()) and only words that change during expansion
+** get a new string.
+**
+** t_tokvec is a contiguous, arena-backed array that always ends with a
+** TOKEN_EOF sentinel, so tok + 1 is valid for every real token.
+*/
+typedef struct s_tok
+{
+	t_token_type	type;
+	size_t			off;
+	size_t			len;
+}	t_tok;
+
+typedef struct s_tokvec
+{
+	t_tok	*data;
+	size_t	len;
+	size_t	cap;
+	char	*line;
+}	t_tokvec;
+
+/*
+** Character classes, see char_class(). The lexer finds word ends and
+** quoted regions with bitmasks over 64-byte blocks: classify_block()
+** turns a block into one mask per class with SSE2/AVX2 when the CPU has
+** it and with the table otherwise.
+*/
+# define CC_SPACE	1
+# define CC_OP		2
+# define CC_QUOTE	4
+# define CC_DOLLAR	8
+# define CC_BSLASH	16
+# define CC_END		32
+# define CC_NAME	64
+# define EVEN_BITS	0x5555555555555555ULL
+
+typedef struct s_cmask
+{
+	uint64_t	blank;
+	uint64_t	op;
+	uint64_t	sq;
+	uint64_t	dq;
+	uint64_t	bs;
+	uint64_t	dol;
+}	t_cmask;
+
+typedef struct s_scanner
+{
+	void	(*classify)(const char *p, t_cmask *m);
+}	t_scanner;
+
+/*
+** Quote state carried from one block into the next: inside single or
+** double quotes, and whether the first byte is escaped by a backslash
+** that ended the previous block.
+*/
+# define QS_SQ		1
+# define QS_DQ		2
+# define QS_ESC		4
+
+typedef struct s_qblock
+{
+	uint64_t	in_sq;
+	uint64_t	in_dq;
+	uint64_t	esc;
+	uint64_t	drop;
+	int			state;
+}	t_qblock;
+
+/*
+** Quoted regions of a line, one bit per byte, 64 bytes per word:
+**   stop  blanks and operators that end a word (not quoted or escaped)
+**   dol   '$' bytes that expand: not in single quotes, not escaped
+**   drop  quote and backslash bytes that quote removal deletes
+** entry[b] is the QS_* state at the start of block b, which is where a
+** continuation line resumes.
+*/
+typedef struct s_qmask
+{
+	uint64_t		*stop;
+	uint64_t		*dol;
+	uint64_t		*drop;
+	unsigned char	*entry;
+	size_t			cap;
+}	t_qmask;
+
+/*
+** A logical line and what scanning it found: the tokens, the quote mask,
+** the quote still open at its end (0 if none), whether it ends in a
+** pending backslash escape and whether continuation lines were joined
+** onto it (offsets then no longer match what is on screen). The reader
+** takes its continuation verdict from here, process_line() parses the
+** cached tokens and the expander and heredoc code read the mask, so
+** nobody rescans the text.
+**
+** buf is owned by the line and keeps LINE_PAD readable bytes past its
+** end for the block loads. It grows by doubling as continuation lines
+** are appended; tokens are offsets, so they stay valid when it moves,
+** and only the appended bytes are scanned (see lexer_resume()).
+*/
+# define LINE_PAD	64
+
+typedef struct s_line
+{
+	char		*buf;
+	size_t		len;
+	size_t		cap;
+	t_tokvec	tokens;
+	t_qmask		qm;
+	char		quote;
+	int			esc;
+	int			joined;
+}	t_line;
+
+int					lexer(t_line *ln);
+int					lexer_run(t_line *ln, size_t i);
+int					lexer_resume(t_line *ln, size_t i);
+int					line_load(t_line *ln, char *src);
+int					line_needs_more(t_line *ln);
+int					line_extend(t_line *ln, char *more);
+int					line_reserve(t_line *ln, size_t need);
+long				line_offset(const char *p);
+int					tv_push(t_tokvec *tv, t_token_type type, size_t off,
+						size_t len);
+int					is_whitespace(char c);
+int					is_operator(char c);
+size_t				measure_word(t_line *ln, size_t i);
+int					get_operator_token(char *s, t_tok *tok);
+int					try_semicolon(char *s, t_tok *tok);
+int					try_or_pipe(char *s, t_tok *tok);
+int					try_and(char *s, t_tok *tok);
+int					try_inredir(char *s, t_tok *tok);
+int					try_outredir(char *s, t_tok *tok);
+const unsigned char	*char_class(void);
+void				classify_block(const char *p, t_cmask *m);
+void				classify_scalar(const char *p, t_cmask *m);
+void				classify_sse2(const char *p, t_cmask *m);
+void				classify_avx2(const char *p, t_cmask *m);
+void				select_scanner(t_scanner *sc);
+uint64_t			prefix_xor(uint64_t x);
+uint64_t			find_escaped(uint64_t bs, int *carry);
+uint64_t			dq_special(const t_cmask *m, const char *p);
+void				qblock_resolve(const t_cmask *m, const char *p,
+						t_qblock *q);
+void				qblock_walk(const t_cmask *m, const char *p,
+						t_qblock *q);
+int					qmask_scan(t_line *ln, size_t from);
+int					qm_bit(const uint64_t *set, size_t i);
+size_t				qm_next(const uint64_t *set, size_t from, size_t to);
+
+#endif
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_class.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 13:20:05 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static void	set_class(unsigned char *table, const char *set, unsigned char cc)
+{
+	while (*set)
+		table[(unsigned char)*set++] |= cc;
+}
+
+static void	build_class(unsigned char *table)
+{
+	int	c;
+
+	table[0] = CC_END;
+	set_class(table, " \t", CC_SPACE);
+	set_class(table, "|<>&;", CC_OP);
+	set_class(table, "'\"", CC_QUOTE);
+	set_class(table, "$", CC_DOLLAR);
+	set_class(table, "\\", CC_BSLASH);
+	c = 0;
+	while (c < 256)
+	{
+		if (ft_isalnum(c) || c == '_')
+			table[c] |= CC_NAME;
+		c++;
+	}
+}
+
+/*
+** 256-entry character class table, built once.
+** Replaces the chains of comparisons the lexer used per byte.
+*/
+const unsigned char	*char_class(void)
+{
+	static unsigned char	table[256];
+	static int				ready;
+
+	if (!ready)
+	{
+		build_class(table);
+		ready = 1;
+	}
+	return (table);
+}
+
+int	is_whitespace(char c)
+{
+	return ((char_class()[(unsigned char)c] & CC_SPACE) != 0);
+}
+
+int	is_operator(char c)
+{
+	return ((char_class()[(unsigned char)c] & CC_OP) != 0);
+}
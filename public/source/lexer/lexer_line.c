@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_line.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 13:40:12 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 16:31:08 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** A failed scan leaves an empty token vector and no pending state,
+** which process_line() treats as nothing to run.
+*/
+static int	line_fail(t_line *ln)
+{
+	ln->tokens.len = 0;
+	ln->quote = 0;
+	ln->esc = 0;
+	return (0);
+}
+
+/*
+** Take src (malloc'd, e.g. from readline) as a new logical line: it is
+** copied into a buffer with LINE_PAD readable bytes past the end, so
+** the scanners can load whole blocks, and freed. The quote mask is
+** built once here and everything after the lexer reads it.
+*/
+int	line_load(t_line *ln, char *src)
+{
+	size_t	len;
+
+	len = ft_strlen(src);
+	ln->buf = NULL;
+	ln->cap = 0;
+	ln->joined = 0;
+	if (!line_reserve(ln, len + 1))
+	{
+		ln->buf = src;
+		ln->len = len;
+		return (line_fail(ln));
+	}
+	ft_memcpy(ln->buf, src, len + 1);
+	free(src);
+	ln->len = len;
+	ft_bzero(&ln->qm, sizeof(ln->qm));
+	if (qmask_scan(ln, 0) && lexer(ln))
+		return (1);
+	return (line_fail(ln));
+}
+
+/*
+** Room for need bytes plus the padding; doubles so a long paste is
+** copied O(log n) times.
+*/
+int	line_reserve(t_line *ln, size_t need)
+{
+	char	*buf;
+	size_t	cap;
+
+	if (need + LINE_PAD <= ln->cap)
+		return (1);
+	cap = ln->cap * 2;
+	if (cap < need + LINE_PAD)
+		cap = need + LINE_PAD;
+	buf = malloc(cap);
+	if (!buf)
+		return (0);
+	ft_bzero(buf + need, cap - need);
+	if (ln->buf)
+		ft_memcpy(buf, ln->buf, ln->len + 1);
+	free(ln->buf);
+	ln->buf = buf;
+	ln->cap = cap;
+	return (1);
+}
+
+/*
+** Bash keeps reading while a quote is open or the line ends in an
+** unescaped backslash, and never checks syntax before that.
+*/
+int	line_needs_more(t_line *ln)
+{
+	return (ln->quote != 0 || ln->esc);
+}
+
+/*
+** Append a continuation line and lex only what it added, so a pasted
+** block of n lines costs O(total length) instead of O(n * length).
+*/
+int	line_extend(t_line *ln, char *more)
+{
+	size_t	i;
+
+	i = ln->len;
+	if (ln->esc)
+		i--;
+	if (!join_continuation(ln, more))
+		return (line_fail(ln));
+	ln->joined = 1;
+	if (qmask_scan(ln, i) && lexer_resume(ln, i))
+		return (1);
+	return (line_fail(ln));
+}
@@ -6,41 +6,37 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/12 15:03:10 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 11:58:40 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 /*
-** Identify and create operator token
-** Handles |, ||, &&, <, <<, >, >>
+** Identify operator token at s
+** Handles |, ||, &&, <, <<, >, >>, ;
+** Fills tok->type and tok->len, returns 0 if s is not an operator
 */
 
-t_token	*try_semicolon(char **input)
+int	try_semicolon(char *s, t_tok *tok)
 {
-	if (**input == ';')
+	if (*s == ';')
 	{
-		(*input)++;
-		return (create_token(TOKEN_SEMICOLON, ";"));
+		tok->type = TOKEN_SEMICOLON;
+		tok->len = 1;
+		return (1);
 	}
-	return (NULL);
+	return (0);
 }
 
-t_token	*get_operator_token(char **input)
+int	get_operator_token(char *s, t_tok *tok)
 {
-	t_token		*tok;
-
-	tok = try_or_pipe(input);
-	if (tok)
-		return (tok);
-	tok = try_and(input);
-	if (tok)
-		return (tok);
-	tok = try_semicolon(input);
-	if (tok)
-		return (tok);
-	tok = try_inredir(input);
-	if (tok)
-		return (tok);
-	return (try_outredir(input));
+	if (try_or_pipe(s, tok))
+		return (1);
+	if (try_and(s, tok))
+		return (1);
+	if (try_semicolon(s, tok))
+		return (1);
+	if (try_inredir(s, tok))
+		return (1);
+	return (try_outredir(s, tok));
 }
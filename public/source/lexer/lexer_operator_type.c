@@ -6,61 +6,49 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/12 15:02:14 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 11:58:40 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
-t_token	*try_or_pipe(char **input)
+static int	set_op(t_tok *tok, t_token_type type, size_t len)
 {
-	if (**input != '|')
-		return (NULL);
-	if (*(*input + 1) == '|')
-	{
-		*input += 2;
-		return (create_token(TOKEN_OR, "||"));
-	}
-	(*input)++;
-	return (create_token(TOKEN_PIPE, "|"));
+	tok->type = type;
+	tok->len = len;
+	return (1);
 }
 
-t_token	*try_and(char **input)
+int	try_or_pipe(char *s, t_tok *tok)
 {
-	if (**input == '&' && *(*input + 1) == '&')
-	{
-		*input += 2;
-		return (create_token(TOKEN_AND, "&&"));
-	}
-	return (NULL);
+	if (*s != '|')
+		return (0);
+	if (s[1] == '|')
+		return (set_op(tok, TOKEN_OR, 2));
+	return (set_op(tok, TOKEN_PIPE, 1));
 }
 
-t_token	*try_inredir(char **input)
+int	try_and(char *s, t_tok *tok)
 {
-	if (**input == '<' && *(*input + 1) == '<')
-	{
-		*input += 2;
-		return (create_token(TOKEN_REDIR_HEREDOC, "<<"));
-	}
-	if (**input == '<')
-	{
-		(*input)++;
-		return (create_token(TOKEN_REDIR_IN, "<"));
-	}
-	return (NULL);
+	if (*s == '&' && s[1] == '&')
+		return (set_op(tok, TOKEN_AND, 2));
+	return (0);
 }
 
-t_token	*try_outredir(char **input)
+int	try_inredir(char *s, t_tok *tok)
 {
-	if (**input == '>' && *(*input + 1) == '>')
-	{
-		*input += 2;
-		return (create_token(TOKEN_REDIR_APPEND, ">>"));
-	}
-	if (**input == '>')
-	{
-		(*input)++;
-		return (create_token(TOKEN_REDIR_OUT, ">"));
-	}
-	return (NULL);
+	if (*s == '<' && s[1] == '<')
+		return (set_op(tok, TOKEN_REDIR_HEREDOC, 2));
+	if (*s == '<')
+		return (set_op(tok, TOKEN_REDIR_IN, 1));
+	return (0);
+}
+
+int	try_outredir(char *s, t_tok *tok)
+{
+	if (*s == '>' && s[1] == '>')
+		return (set_op(tok, TOKEN_REDIR_APPEND, 2));
+	if (*s == '>')
+		return (set_op(tok, TOKEN_REDIR_OUT, 1));
+	return (0);
 }
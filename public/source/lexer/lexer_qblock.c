@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_qblock.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:12:40 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 15:40:12 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** Bytes that follow a '"', '$' or '\' (the next block's first byte
+** included): in double quotes only a backslash before one of these is
+** removed, before anything else it stays.
+*/
+uint64_t	dq_special(const t_cmask *m, const char *p)
+{
+	uint64_t	next;
+
+	next = (p[64] == '"' || p[64] == '$' || p[64] == '\\');
+	return (((m->dq | m->dol | m->bs) >> 1) | (next << 63));
+}
+
+/*
+** No single quote in the block and none open: every backslash is
+** active, so the escapes come straight from find_escaped() and the
+** double quotes that are left toggle the region by prefix XOR.
+*/
+static void	block_dq(const t_cmask *m, const char *p, t_qblock *q)
+{
+	int			carry;
+	uint64_t	real;
+	uint64_t	region;
+	uint64_t	escaper;
+
+	carry = (q->state & QS_ESC) != 0;
+	q->esc = find_escaped(m->bs, &carry);
+	real = m->dq & ~q->esc;
+	region = prefix_xor(real);
+	if (q->state & QS_DQ)
+		region = ~region;
+	q->in_dq = region & ~real;
+	escaper = m->bs & ~q->esc;
+	q->drop = real | (escaper & (~q->in_dq | dq_special(m, p)));
+	q->state = (int)(region >> 63) * QS_DQ + carry * QS_ESC;
+}
+
+/*
+** No double quote and no backslash, and no escape pending: only single
+** quotes toggle anything.
+*/
+static void	block_sq(const t_cmask *m, t_qblock *q)
+{
+	uint64_t	region;
+
+	region = prefix_xor(m->sq);
+	if (q->state & QS_SQ)
+		region = ~region;
+	q->in_sq = region & ~m->sq;
+	q->drop = m->sq;
+	q->state = (int)(region >> 63) * QS_SQ;
+}
+
+/*
+** Quote regions of one block from its class masks and the state it
+** starts in (q->state, updated to the state it ends in). Blocks that
+** stay inside one quote, have only one kind of quote, or only double
+** quotes and backslashes are resolved with bit operations; the rest
+** (both quote kinds mixed) are walked quote by quote.
+*/
+void	qblock_resolve(const t_cmask *m, const char *p, t_qblock *q)
+{
+	q->in_sq = 0;
+	q->in_dq = 0;
+	q->esc = 0;
+	q->drop = 0;
+	if (q->state == QS_SQ && !m->sq)
+		q->in_sq = ~(uint64_t)0;
+	else if (q->state == QS_DQ && !m->dq && !m->bs)
+		q->in_dq = ~(uint64_t)0;
+	else if (!(q->state & QS_SQ) && !m->sq)
+		block_dq(m, p, q);
+	else if ((q->state == 0 || q->state == QS_SQ) && !m->dq && !m->bs)
+		block_sq(m, q);
+	else
+		qblock_walk(m, p, q);
+}
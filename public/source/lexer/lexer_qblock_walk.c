@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_qblock_walk.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:12:40 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 15:40:12 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/* bit is escaped; a backslash in the last byte escapes the next block */
+static uint64_t	escape(t_qblock *q, uint64_t ev, uint64_t bit)
+{
+	if (!bit)
+	{
+		q->state |= QS_ESC;
+		return (ev);
+	}
+	q->esc |= bit;
+	return (ev & ~bit);
+}
+
+/*
+** One quote or backslash. The quotes that open or close a region are
+** collected in in_sq / in_dq for now. Returns 1 when the byte after it
+** is escaped.
+*/
+static int	step(const t_cmask *m, const char *p, t_qblock *q,
+		uint64_t bit)
+{
+	if (q->state == QS_SQ)
+	{
+		q->in_sq |= m->sq & bit;
+		if (m->sq & bit)
+			q->state = 0;
+		return (0);
+	}
+	if (m->bs & bit)
+	{
+		if (!q->state || (dq_special(m, p) & bit))
+			q->drop |= bit;
+		return (1);
+	}
+	if (m->dq & bit)
+	{
+		q->in_dq |= bit;
+		q->state ^= QS_DQ;
+	}
+	else if (!q->state)
+	{
+		q->in_sq |= bit;
+		q->state = QS_SQ;
+	}
+	return (0);
+}
+
+/* the regions between the collected quotes, by prefix XOR */
+static void	finish(t_qblock *q, int entry)
+{
+	uint64_t	sq;
+	uint64_t	dq;
+	uint64_t	region;
+
+	sq = q->in_sq;
+	dq = q->in_dq;
+	q->drop |= sq | dq;
+	region = prefix_xor(sq);
+	if (entry == QS_SQ)
+		region = ~region;
+	q->in_sq = region & ~sq;
+	region = prefix_xor(dq);
+	if (entry == QS_DQ)
+		region = ~region;
+	q->in_dq = region & ~dq;
+}
+
+/*
+** Blocks that mix both kinds of quote: the rules depend on which quote
+** is open, so the quotes and backslashes are taken in order, one set
+** bit at a time; the bytes between them are never looked at.
+*/
+void	qblock_walk(const t_cmask *m, const char *p, t_qblock *q)
+{
+	uint64_t	ev;
+	uint64_t	bit;
+	int			entry;
+
+	entry = q->state & (QS_SQ | QS_DQ);
+	ev = m->sq | m->dq | m->bs;
+	if (q->state & QS_ESC)
+		ev = escape(q, ev, 1);
+	q->state = entry;
+	while (ev)
+	{
+		bit = ev & -ev;
+		ev &= ~bit;
+		if (step(m, p, q, bit))
+			ev = escape(q, ev, bit << 1);
+	}
+	finish(q, entry);
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_qmask.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:12:40 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 18:41:10 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static int	grow_set(void **set, size_t old, size_t size)
+{
+	void	*p;
+
+	p = arena_grow(&g_shell.arena, *set, old, size);
+	if (!p)
+		return (0);
+	*set = p;
+	return (1);
+}
+
+static int	qm_reserve(t_qmask *qm, size_t blocks)
+{
+	size_t	cap;
+	size_t	w;
+
+	if (blocks <= qm->cap)
+		return (1);
+	cap = qm->cap * 2;
+	if (cap < blocks)
+		cap = blocks;
+	w = sizeof(uint64_t);
+	if (!grow_set((void **)&qm->stop, qm->cap * w, cap * w)
+		|| !grow_set((void **)&qm->dol, qm->cap * w, cap * w)
+		|| !grow_set((void **)&qm->drop, qm->cap * w, cap * w)
+		|| !grow_set((void **)&qm->entry, qm->cap, cap))
+		return (0);
+	qm->cap = cap;
+	return (1);
+}
+
+static void	mask_valid(t_cmask *m, size_t n)
+{
+	uint64_t	valid;
+
+	valid = ~(uint64_t)0;
+	if (n < 64)
+		valid = ((uint64_t)1 << n) - 1;
+	m->blank &= valid;
+	m->op &= valid;
+	m->sq &= valid;
+	m->dq &= valid;
+	m->bs &= valid;
+	m->dol &= valid;
+}
+
+static void	store_block(t_qmask *qm, size_t b, const t_cmask *m,
+		const t_qblock *q)
+{
+	qm->stop[b] = (m->blank | m->op) & ~(q->in_sq | q->in_dq | q->esc);
+	qm->dol[b] = m->dol & ~(q->in_sq | q->esc);
+	qm->drop[b] = q->drop;
+}
+
+/*
+** (Re)build the quote mask of ln from byte from to the end of the line,
+** starting at the block that holds from with the state recorded for it,
+** and record what is still open at the end of the line.
+*/
+int	qmask_scan(t_line *ln, size_t from)
+{
+	t_cmask		m;
+	t_qblock	q;
+	size_t		b;
+
+	if (!qm_reserve(&ln->qm, ln->len / 64 + 1))
+		return (0);
+	b = from / 64;
+	if (b == 0)
+		ln->qm.entry[0] = 0;
+	q.state = ln->qm.entry[b];
+	while (b <= ln->len / 64)
+	{
+		ln->qm.entry[b] = q.state;
+		classify_block(ln->buf + b * 64, &m);
+		mask_valid(&m, ln->len - b * 64);
+		qblock_resolve(&m, ln->buf + b * 64, &q);
+		store_block(&ln->qm, b, &m, &q);
+		b++;
+	}
+	ln->quote = "\0'\""[q.state & (QS_SQ | QS_DQ)];
+	ln->esc = (q.esc >> (ln->len & 63)) & 1;
+	return (1);
+}
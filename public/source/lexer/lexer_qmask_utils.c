@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_qmask_utils.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 15:12:40 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 15:40:12 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+int	qm_bit(const uint64_t *set, size_t i)
+{
+	return ((set[i / 64] >> (i & 63)) & 1);
+}
+
+/*
+** First set bit of set in [from, to), or to when there is none.
+*/
+size_t	qm_next(const uint64_t *set, size_t from, size_t to)
+{
+	size_t		b;
+	uint64_t	w;
+
+	if (from >= to)
+		return (to);
+	b = from / 64;
+	w = set[b] & (~(uint64_t)0 << (from & 63));
+	while (!w && ++b * 64 < to)
+		w = set[b];
+	if (!w)
+		return (to);
+	from = b * 64 + __builtin_ctzll(w);
+	if (from > to)
+		return (to);
+	return (from);
+}
+
+/*
+** Offset of p in the current line, or -1 for a string that does not
+** live there (an expansion result, a heredoc line).
+*/
+long	line_offset(const char *p)
+{
+	const char	*buf;
+
+	buf = g_shell.line.buf;
+	if (!buf || p < buf || p > buf + g_shell.line.len)
+		return (-1);
+	return (p - buf);
+}
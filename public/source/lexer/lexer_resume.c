@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_resume.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 14:31:08 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 15:40:12 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** The pending word was nothing but the continuation backslash, which is
+** gone now. Drop its token, and an operator right before it too, so
+** "|\" followed by "|" is lexed again as "||". Returns where to go on.
+*/
+static size_t	drop_empty_word(t_tokvec *tv, size_t i)
+{
+	t_tok	*prev;
+
+	tv->len--;
+	if (tv->len == 0)
+		return (i);
+	prev = &tv->data[tv->len - 1];
+	if (prev->off + prev->len != i)
+		return (i);
+	tv->len--;
+	return (prev->off);
+}
+
+/*
+** Finish the word the last scan stopped in (an open quote or a
+** continuation backslash) from byte i on, then lex the rest as usual.
+** Everything before i was lexed already and is not looked at again.
+** A line the lexer gave up on early (a lone '&') goes on from there,
+** the continuation may have made it "&&".
+*/
+int	lexer_resume(t_line *ln, size_t i)
+{
+	t_tok	*tok;
+
+	if (ln->tokens.data[ln->tokens.len].off < i)
+		return (lexer_run(ln, ln->tokens.data[ln->tokens.len].off));
+	if (ln->tokens.len == 0)
+		return (lexer_run(ln, i));
+	tok = &ln->tokens.data[ln->tokens.len - 1];
+	if (tok->off == i)
+		return (lexer_run(ln, drop_empty_word(&ln->tokens, i)));
+	i += measure_word(ln, i);
+	tok->len = i - tok->off;
+	return (lexer_run(ln, i));
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_scan.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 15:40:12 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+void	classify_scalar(const char *p, t_cmask *m)
+{
+	const unsigned char	*cls;
+	unsigned char		c;
+	uint64_t			bit;
+	int					j;
+
+	cls = char_class();
+	ft_bzero(m, sizeof(*m));
+	j = 0;
+	while (j < 64)
+	{
+		c = (unsigned char)p[j];
+		bit = (uint64_t)1 << j;
+		m->blank |= bit * ((cls[c] & CC_SPACE) != 0);
+		m->op |= bit * ((cls[c] & CC_OP) != 0);
+		m->sq |= bit * (c == '\'');
+		m->dq |= bit * (c == '"');
+		m->bs |= bit * ((cls[c] & CC_BSLASH) != 0);
+		m->dol |= bit * ((cls[c] & CC_DOLLAR) != 0);
+		j++;
+	}
+}
+
+static const t_scanner	*scanner(void)
+{
+	static t_scanner	sc;
+
+	if (!sc.classify)
+		select_scanner(&sc);
+	return (&sc);
+}
+
+/*
+** One mask per character class for the 64 bytes at p. The caller
+** guarantees all 64 are readable (see LINE_PAD) and masks off the ones
+** past the end of the line.
+*/
+void	classify_block(const char *p, t_cmask *m)
+{
+	scanner()->classify(p, m);
+}
+
+/*
+** Bit i of the result is the XOR of bits 0..i of x: with x the quote
+** characters it is set from an opening quote up to, not including, the
+** quote that closes it.
+*/
+uint64_t	prefix_xor(uint64_t x)
+{
+	x ^= x << 1;
+	x ^= x << 2;
+	x ^= x << 4;
+	x ^= x << 8;
+	x ^= x << 16;
+	x ^= x << 32;
+	return (x);
+}
+
+/*
+** Bytes escaped by a backslash, for a block in which every backslash is
+** active: a byte is escaped when it follows an odd run of them. Runs
+** that start on an odd bit are moved onto even ones by the addition, so
+** one XOR against the even bits tells the parity for all of them.
+** *carry says whether the first byte is escaped on entry and whether the
+** first byte of the next block is on return.
+*/
+uint64_t	find_escaped(uint64_t bs, int *carry)
+{
+	uint64_t	follows;
+	uint64_t	odd_starts;
+	uint64_t	seq;
+
+	bs &= ~(uint64_t)*carry;
+	follows = (bs << 1) | (uint64_t)*carry;
+	odd_starts = bs & ~EVEN_BITS & ~follows;
+	*carry = __builtin_add_overflow(odd_starts, bs, &seq);
+	return ((EVEN_BITS ^ (seq << 1)) & follows);
+}
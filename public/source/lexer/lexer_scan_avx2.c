@@ -0,0 +1,60 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_scan_avx2.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 15:40:12 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+# include <immintrin.h>
+
+__attribute__((target("avx2")))
+static uint64_t	eq1(__m256i v, char a)
+{
+	__m256i	m;
+
+	m = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(a));
+	return ((uint64_t)(unsigned int)_mm256_movemask_epi8(m));
+}
+
+__attribute__((target("avx2")))
+static uint64_t	eq2(__m256i v, char a, char b)
+{
+	__m256i	m;
+
+	m = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(a)),
+			_mm256_cmpeq_epi8(v, _mm256_set1_epi8(b)));
+	return ((uint64_t)(unsigned int)_mm256_movemask_epi8(m));
+}
+
+__attribute__((target("avx2")))
+static void	classify32(const char *p, t_cmask *m, int shift)
+{
+	__m256i	v;
+
+	v = _mm256_loadu_si256((const __m256i *)p);
+	m->blank |= eq2(v, ' ', '\t') << shift;
+	m->op |= (eq2(v, '|', '&') | eq2(v, '<', '>') | eq1(v, ';')) << shift;
+	m->sq |= eq1(v, '\'') << shift;
+	m->dq |= eq1(v, '"') << shift;
+	m->bs |= eq1(v, '\\') << shift;
+	m->dol |= eq1(v, '$') << shift;
+}
+
+__attribute__((target("avx2")))
+void	classify_avx2(const char *p, t_cmask *m)
+{
+	ft_bzero(m, sizeof(*m));
+	classify32(p, m, 0);
+	classify32(p + 32, m, 32);
+}
+
+#endif
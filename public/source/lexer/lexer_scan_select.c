@@ -1,24 +1,32 @@
 /* ************************************************************************** */
 /*                                                                            */
 /*                                                        :::      ::::::::   */
-/*   executor_pipeline_helpers.c                        :+:      :+:    :+:   */
+/*   lexer_scan_select.c                                :+:      :+:    :+:   */
 /*                                                    +:+ +:+         +:+     */
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/11/23 00:00:00 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/23 00:00:00 by malmarzo         ###   ########.fr       */
+/*   Created: 2026/10/17 13:20:05 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 15:40:12 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
-int	update_prev_fd(int prev_read_fd, int pipefd[2], int has_next)
+#if defined(__x86_64__) || defined(__i386__)
+
+void	select_scanner(t_scanner *sc)
+{
+	__builtin_cpu_init();
+	sc->classify = &classify_sse2;
+	if (__builtin_cpu_supports("avx2"))
+		sc->classify = &classify_avx2;
+}
+
+#else
+
+void	select_scanner(t_scanner *sc)
 {
-	safe_close(prev_read_fd);
-	if (has_next)
-	{
-		safe_close(pipefd[1]);
-		return (pipefd[0]);
-	}
-	return (-1);
+	sc->classify = &classify_scalar;
 }
+
+#endif
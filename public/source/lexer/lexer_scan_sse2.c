@@ -0,0 +1,58 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_scan_sse2.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 15:40:12 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+# include <emmintrin.h>
+
+static uint64_t	eq1(__m128i v, char a)
+{
+	__m128i	m;
+
+	m = _mm_cmpeq_epi8(v, _mm_set1_epi8(a));
+	return ((uint64_t)(unsigned int)_mm_movemask_epi8(m));
+}
+
+static uint64_t	eq2(__m128i v, char a, char b)
+{
+	__m128i	m;
+
+	m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(a)),
+			_mm_cmpeq_epi8(v, _mm_set1_epi8(b)));
+	return ((uint64_t)(unsigned int)_mm_movemask_epi8(m));
+}
+
+static void	classify16(const char *p, t_cmask *m, int shift)
+{
+	__m128i	v;
+
+	v = _mm_loadu_si128((const __m128i *)p);
+	m->blank |= eq2(v, ' ', '\t') << shift;
+	m->op |= (eq2(v, '|', '&') | eq2(v, '<', '>') | eq1(v, ';')) << shift;
+	m->sq |= eq1(v, '\'') << shift;
+	m->dq |= eq1(v, '"') << shift;
+	m->bs |= eq1(v, '\\') << shift;
+	m->dol |= eq1(v, '$') << shift;
+}
+
+void	classify_sse2(const char *p, t_cmask *m)
+{
+	ft_bzero(m, sizeof(*m));
+	classify16(p, m, 0);
+	classify16(p + 16, m, 16);
+	classify16(p + 32, m, 32);
+	classify16(p + 48, m, 48);
+}
+
+#endif
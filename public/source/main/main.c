@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/13 15:04:45 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/18 01:05:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,17 +16,21 @@ t_shell	g_shell;
 
 int	main(int argc, char **argv, char **envp)
 {
-	(void)argc;
-	(void)argv;
 	write(1, "\033[2J\033[H", 7);
 	print_logo();
 	init_shell(&g_shell, envp);
+	if (argc > 1 && ft_strcmp(argv[1], "--dump-plan") == 0)
+		g_shell.dump_plan = 1;
 	setup_signals();
 	history_init(&g_shell);
 	shell_loop(&g_shell);
 	history_save(&g_shell);
 	rl_clear_history();
 	free_env(g_shell.env);
+	pcache_destroy(&g_shell.pcache);
+	hash_destroy(&g_shell.hash);
+	stages_destroy(&g_shell.stages);
+	arena_destroy(&g_shell.arena);
 	free(g_shell.history_path);
 	return (g_shell.exit_status);
 }
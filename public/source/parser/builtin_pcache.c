@@ -0,0 +1,45 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_pcache.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:10:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 09:10:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/*
+** pcache: the parse cache's counters since the shell started, as
+** "parse cache: H hits, M misses, N/CAP entries", or that it is off.
+** A builtin, so it shadows any pcache program in PATH.
+*/
+int	builtin_pcache(char **args, t_shell *shell)
+{
+	t_pcache	*pc;
+
+	if (args[1])
+	{
+		print_error("pcache", "usage: pcache");
+		return (2);
+	}
+	pc = &shell->pcache;
+	if (!pc->cap)
+	{
+		ft_putendl_fd("parse cache: off", 1);
+		return (0);
+	}
+	ft_putstr_fd("parse cache: ", 1);
+	ft_putnbr_fd((int)pc->hits, 1);
+	ft_putstr_fd(" hits, ", 1);
+	ft_putnbr_fd((int)pc->misses, 1);
+	ft_putstr_fd(" misses, ", 1);
+	ft_putnbr_fd((int)pc->count, 1);
+	ft_putchar_fd('/', 1);
+	ft_putnbr_fd((int)pc->cap, 1);
+	ft_putendl_fd(" entries", 1);
+	return (0);
+}
@@ -6,116 +6,113 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/06 14:16:03 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 16:31:08 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
-static t_redir	*parse_single_redirection(t_token **tokens)
+/*
+** A redirection needs a word after it. Another redirection right after
+** it is reported as a run (`>>>' and the like), anything else by the
+** token that is there instead.
+*/
+static t_redir	*parse_single_redirection(t_parser *p)
 {
 	t_redir	*redir;
 
-	if (!*tokens)
-		return (NULL);
-	if ((*tokens)->type != TOKEN_REDIR_IN
-		&& (*tokens)->type != TOKEN_REDIR_OUT
-		&& (*tokens)->type != TOKEN_REDIR_APPEND
-		&& (*tokens)->type != TOKEN_REDIR_HEREDOC)
-		return (NULL);
-	if (!(*tokens)->next || !(*tokens)->next->value)
+	if (!is_valid_word(p->tok + 1))
 	{
-		ft_putendl_fd(
-			"minishell: syntax error near unexpected token "
-			"`newline'",
-			2);
-		return (NULL);
+		if (is_redirection(p->tok + 1))
+			return (syntax_at(p, p->tok));
+		return (syntax_at(p, p->tok + 1));
 	}
-	redir = create_redir((*tokens)->type, (*tokens)->next->value);
+	redir = create_redir(p->tok->type, tok_word(p, p->tok + 1));
 	if (!redir)
 		return (NULL);
-	*tokens = (*tokens)->next->next;
+	p->tok += 2;
 	return (redir);
 }
 
-static int	count_args(t_token *tokens)
-{
-	int	count;
-
-	count = 0;
-	while (tokens && (tokens->type == TOKEN_WORD
-			|| tokens->type == TOKEN_REDIR_IN
-			|| tokens->type == TOKEN_REDIR_OUT
-			|| tokens->type == TOKEN_REDIR_APPEND
-			|| tokens->type == TOKEN_REDIR_HEREDOC))
-	{
-		if (tokens->type == TOKEN_WORD)
-		{
-			count++;
-			tokens = tokens->next;
-		}
-		else if (tokens->next)
-			tokens = tokens->next->next;
-		else
-			break ;
-	}
-	return (count);
-}
-
-static t_cmd	*new_cmd(int arg_count)
+static t_cmd	*new_cmd(void)
 {
 	t_cmd	*cmd;
 
-	cmd = malloc(sizeof(t_cmd));
+	cmd = arena_alloc(&g_shell.arena, sizeof(t_cmd));
 	if (!cmd)
 		return (NULL);
 	cmd->expanded = 0;
-	cmd->args = malloc(sizeof(char *) * (arg_count + 1));
+	cmd->args = arena_alloc(&g_shell.arena, sizeof(char *) * CMD_ARGS_INIT);
 	if (!cmd->args)
-	{
-		free(cmd);
 		return (NULL);
-	}
 	cmd->redirs = NULL;
 	cmd->next = NULL;
 	return (cmd);
 }
 
-static void	consume_redirs(t_token **tokens, t_cmd *cmd)
+/*
+** Room for argument n and the NULL after it. The vector doubles, so a
+** command with n words is built in O(n) without counting them first.
+*/
+static int	reserve_arg(t_cmd *cmd, int *cap, int n)
+{
+	char	**args;
+
+	if (n + 1 < *cap)
+		return (1);
+	args = arena_grow(&g_shell.arena, cmd->args,
+			sizeof(char *) * *cap, sizeof(char *) * *cap * 2);
+	if (!args)
+		return (0);
+	cmd->args = args;
+	*cap *= 2;
+	return (1);
+}
+
+static int	consume_redirs(t_parser *p)
 {
 	t_redir	*new_redir;
 
-	while (*tokens && ((*tokens)->type == TOKEN_REDIR_IN
-			|| (*tokens)->type == TOKEN_REDIR_OUT
-			|| (*tokens)->type == TOKEN_REDIR_APPEND
-			|| (*tokens)->type == TOKEN_REDIR_HEREDOC))
+	while (is_redirection(p->tok))
 	{
-		new_redir = parse_single_redirection(tokens);
+		new_redir = parse_single_redirection(p);
 		if (!new_redir)
-			break ;
-		append_redir(&cmd->redirs, new_redir);
+			return (0);
+		*p->redir_tail = new_redir;
+		p->redir_tail = &new_redir->next;
 	}
+	return (1);
 }
 
-t_cmd	*parse_command(t_token **tokens)
+/*
+** Words and redirections in one pass: words go to the growing argv,
+** redirections to the tail of cmd->redirs. A command has to start with
+** one of the two; whatever else is there is the syntax error.
+*/
+t_cmd	*parse_command(t_parser *p)
 {
 	t_cmd	*cmd;
 	int		i;
-	int		arg_count;
+	int		cap;
 
-	if (!tokens || !*tokens)
-		return (NULL);
-	arg_count = count_args(*tokens);
-	cmd = new_cmd(arg_count);
+	if (!is_valid_word(p->tok) && !is_redirection(p->tok))
+		return (syntax_at(p, p->tok));
+	cmd = new_cmd();
 	if (!cmd)
 		return (NULL);
+	cap = CMD_ARGS_INIT;
 	i = 0;
-	consume_redirs(tokens, cmd);
-	while (*tokens && (*tokens)->type == TOKEN_WORD)
+	p->redir_tail = &cmd->redirs;
+	if (!consume_redirs(p))
+		return (NULL);
+	while (p->tok->type == TOKEN_WORD)
 	{
-		cmd->args[i++] = ft_strdup((*tokens)->value);
-		*tokens = (*tokens)->next;
-		consume_redirs(tokens, cmd);
+		if (!reserve_arg(cmd, &cap, i))
+			return (NULL);
+		cmd->args[i++] = tok_word(p, p->tok);
+		p->tok++;
+		if (!consume_redirs(p))
+			return (NULL);
 	}
 	cmd->args[i] = NULL;
 	return (cmd);
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 12:20:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef PARSER_H
+# define PARSER_H
+
+/*
+** Cursor over the token vector. tok always points at a valid entry
+** (at worst the TOKEN_EOF sentinel); line is the buffer the spans refer to.
+** redir_tail is the next field the current command's next redirection
+** goes into, so appending never walks the list. Syntax is checked in
+** the same pass: err is the first token found out of place, the one
+** the message names (the EOF sentinel for `newline').
+*/
+typedef struct s_parser
+{
+	t_tok	*tok;
+	char	*line;
+	t_redir	**redir_tail;
+	t_tok	*err;
+}	t_parser;
+
+/* first guess for a command's argv, doubled in the arena as needed */
+# define CMD_ARGS_INIT	8
+
+/*
+** Parse cache: lines sent again and again (scripts, automation) skip
+** the lexer and the parser. An entry is one malloc'd block holding the
+** line's text (the key), its buffer as the parser left it (words
+** terminated in place), its quote mask and a copy of the pre-expansion
+** tree whose words point into that buffer. A hit copies the buffer
+** into the line and the tree into the arena, rebasing the words, so
+** the expander can mutate the copy and never the template.
+**
+** Entries are found by an FNV-1a hash of the text and evicted least
+** recently used first. MINISHELL_PARSE_CACHE in the startup
+** environment sets the capacity (0 turns the cache off). The pcache
+** builtin prints the hit and miss counts; build with -D PCACHE_DEBUG=1
+** to have them printed on exit as well.
+*/
+# ifndef PCACHE_DEBUG
+#  define PCACHE_DEBUG 0
+# endif
+
+# define PCACHE_CAP	64
+# define PCACHE_MAX	4096
+
+typedef struct s_pcent
+{
+	uint64_t		hash;
+	size_t			len;
+	char			*key;
+	char			*image;
+	uint64_t		*stop;
+	uint64_t		*dol;
+	uint64_t		*drop;
+	t_pipeline		*tree;
+	size_t			tree_size;
+	struct s_pcent	*hnext;
+	struct s_pcent	*prev;
+	struct s_pcent	*next;
+}	t_pcent;
+
+/*
+** hash is the hash of the line being read and hit the entry it came
+** from (NULL on a miss); mru/lru are the ends of the recency list.
+*/
+typedef struct s_pcache
+{
+	t_pcent			**buckets;
+	size_t			nbuckets;
+	size_t			cap;
+	size_t			count;
+	t_pcent			*mru;
+	t_pcent			*lru;
+	uint64_t		hash;
+	t_pcent			*hit;
+	unsigned long	hits;
+	unsigned long	misses;
+}	t_pcache;
+
+/* cursor for pcache_copy(): pieces are carved out of mem in order */
+typedef struct s_pcopy
+{
+	char	*mem;
+	char	*from;
+	char	*to;
+}	t_pcopy;
+
+t_pipeline	*parser(t_tokvec *tv, long *err_off);
+t_cmd		*parse_command(t_parser *p);
+t_cmd		*parse_pipe_sequence(t_parser *p);
+int			set_logic_and_advance(t_pipeline *pl, t_parser *p);
+char		*tok_word(t_parser *p, t_tok *t);
+void		*syntax_at(t_parser *p, t_tok *t);
+int			is_valid_word(t_tok *token);
+int			is_control_operator(t_tok *token);
+int			is_redirection(t_tok *token);
+int			is_gt(t_tok *t);
+int			is_lt(t_tok *t);
+int			tok_op_len(t_tok *t);
+void		print_run_error(t_tok *t);
+void		print_syntax_error(t_tok *token);
+void		print_syntax_offset(t_line *ln, long off);
+void		pcache_init(t_pcache *pc, t_env *env);
+void		pcache_destroy(t_pcache *pc);
+uint64_t	pcache_hash(const char *s, size_t len);
+t_pcent		*pcache_lookup(t_pcache *pc, const char *s, size_t len);
+void		pcache_insert(t_pcache *pc, t_pcent *e);
+void		pcache_store(t_pcache *pc, const char *key, t_line *ln,
+				t_pipeline *tree);
+size_t		pcache_tree_size(t_pipeline *pl);
+t_pipeline	*pcache_copy(t_pipeline *pl, char *mem, char *from, char *to);
+
+#endif
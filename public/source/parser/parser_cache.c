@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser_cache.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:02:44 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 17:20:15 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static void	lru_unlink(t_pcache *pc, t_pcent *e)
+{
+	if (e->prev)
+		e->prev->next = e->next;
+	else
+		pc->mru = e->next;
+	if (e->next)
+		e->next->prev = e->prev;
+	else
+		pc->lru = e->prev;
+	e->prev = NULL;
+	e->next = NULL;
+}
+
+static void	lru_push(t_pcache *pc, t_pcent *e)
+{
+	e->prev = NULL;
+	e->next = pc->mru;
+	if (pc->mru)
+		pc->mru->prev = e;
+	pc->mru = e;
+	if (!pc->lru)
+		pc->lru = e;
+}
+
+/*
+** Drop the least recently used entry, from its bucket chain too.
+*/
+static void	evict(t_pcache *pc)
+{
+	t_pcent	*old;
+	t_pcent	**link;
+
+	old = pc->lru;
+	if (!old)
+		return ;
+	link = &pc->buckets[old->hash & (pc->nbuckets - 1)];
+	while (*link != old)
+		link = &(*link)->hnext;
+	*link = old->hnext;
+	lru_unlink(pc, old);
+	free(old);
+	pc->count--;
+}
+
+void	pcache_insert(t_pcache *pc, t_pcent *e)
+{
+	t_pcent	**bucket;
+
+	if (pc->count >= pc->cap)
+		evict(pc);
+	bucket = &pc->buckets[e->hash & (pc->nbuckets - 1)];
+	e->hnext = *bucket;
+	*bucket = e;
+	lru_push(pc, e);
+	pc->count++;
+}
+
+/*
+** Find the line s (len bytes, hashed into pc->hash) and make it the
+** most recently used entry. The text is compared in full, so a hash
+** collision is only a miss.
+*/
+t_pcent	*pcache_lookup(t_pcache *pc, const char *s, size_t len)
+{
+	t_pcent	*e;
+
+	e = pc->buckets[pc->hash & (pc->nbuckets - 1)];
+	while (e && (e->hash != pc->hash || e->len != len
+			|| ft_memcmp(e->key, s, len) != 0))
+		e = e->hnext;
+	if (!e)
+	{
+		pc->misses++;
+		return (NULL);
+	}
+	pc->hits++;
+	lru_unlink(pc, e);
+	lru_push(pc, e);
+	return (e);
+}
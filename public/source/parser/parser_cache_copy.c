@@ -0,0 +1,104 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser_cache_copy.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:02:44 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 17:20:15 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static void	*take(t_pcopy *c, size_t size)
+{
+	void	*p;
+
+	p = c->mem;
+	c->mem += size;
+	return (p);
+}
+
+static t_redir	*copy_redirs(t_pcopy *c, t_redir *r)
+{
+	t_redir	*head;
+	t_redir	**tail;
+
+	head = NULL;
+	tail = &head;
+	while (r)
+	{
+		*tail = take(c, sizeof(t_redir));
+		**tail = *r;
+		(*tail)->file = c->to + (r->file - c->from);
+		tail = &(*tail)->next;
+		r = r->next;
+	}
+	*tail = NULL;
+	return (head);
+}
+
+static t_cmd	*copy_cmd(t_pcopy *c, t_cmd *src)
+{
+	t_cmd	*cmd;
+	size_t	n;
+
+	cmd = take(c, sizeof(t_cmd));
+	*cmd = *src;
+	n = 0;
+	while (src->args && src->args[n])
+		n++;
+	cmd->args = take(c, (n + 1) * sizeof(char *));
+	cmd->args[n] = NULL;
+	while (n-- > 0)
+		cmd->args[n] = c->to + (src->args[n] - c->from);
+	cmd->redirs = copy_redirs(c, src->redirs);
+	cmd->next = NULL;
+	return (cmd);
+}
+
+static t_pipeline	*copy_tree(t_pcopy *c, t_pipeline *pl)
+{
+	t_pipeline	*head;
+	t_pipeline	**tail;
+	t_cmd		**cmds;
+	t_cmd		*cmd;
+
+	head = NULL;
+	tail = &head;
+	while (pl)
+	{
+		*tail = take(c, sizeof(t_pipeline));
+		**tail = *pl;
+		cmds = &(*tail)->cmds;
+		cmd = pl->cmds;
+		while (cmd)
+		{
+			*cmds = copy_cmd(c, cmd);
+			cmds = &(*cmds)->next;
+			cmd = cmd->next;
+		}
+		*cmds = NULL;
+		tail = &(*tail)->next;
+		pl = pl->next;
+	}
+	*tail = NULL;
+	return (head);
+}
+
+/*
+** Copy pl into mem, which must hold pcache_tree_size(pl) bytes, moving
+** every word from the buffer from to the same offset in to. Used both
+** ways: into a cache entry and back out into a new line.
+*/
+t_pipeline	*pcache_copy(t_pipeline *pl, char *mem, char *from, char *to)
+{
+	t_pcopy	c;
+
+	c.mem = mem;
+	c.from = from;
+	c.to = to;
+	return (copy_tree(&c, pl));
+}
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser_cache_init.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:02:44 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 17:20:15 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static size_t	cache_cap(t_env *env)
+{
+	char	*s;
+	long	n;
+
+	s = get_env_value(env, "MINISHELL_PARSE_CACHE");
+	if (!s || !*s)
+		return (PCACHE_CAP);
+	n = ft_atoi(s);
+	if (n < 0)
+		return (0);
+	if (n > PCACHE_MAX)
+		return (PCACHE_MAX);
+	return ((size_t)n);
+}
+
+/*
+** Sized once from the startup environment. Without room for the
+** buckets the cache just stays off.
+*/
+void	pcache_init(t_pcache *pc, t_env *env)
+{
+	ft_bzero(pc, sizeof(*pc));
+	pc->cap = cache_cap(env);
+	if (!pc->cap)
+		return ;
+	pc->nbuckets = 1;
+	while (pc->nbuckets < pc->cap * 2)
+		pc->nbuckets *= 2;
+	pc->buckets = ft_calloc(pc->nbuckets, sizeof(t_pcent *));
+	if (!pc->buckets)
+		pc->cap = 0;
+}
+
+void	pcache_destroy(t_pcache *pc)
+{
+	t_pcent	*e;
+
+	if (PCACHE_DEBUG)
+	{
+		ft_putstr_fd("minishell: parse cache: ", 2);
+		ft_putnbr_fd((int)pc->hits, 2);
+		ft_putstr_fd(" hits, ", 2);
+		ft_putnbr_fd((int)pc->misses, 2);
+		ft_putendl_fd(" misses", 2);
+	}
+	while (pc->mru)
+	{
+		e = pc->mru;
+		pc->mru = e->next;
+		free(e);
+	}
+	free(pc->buckets);
+	ft_bzero(pc, sizeof(*pc));
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parser_cache_store.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 17:02:44 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 18:41:10 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static size_t	cmd_size(t_cmd *cmd)
+{
+	size_t	size;
+	char	**arg;
+	t_redir	*r;
+
+	size = sizeof(t_cmd) + sizeof(char *);
+	arg = cmd->args;
+	while (arg && *arg++)
+		size += sizeof(char *);
+	r = cmd->redirs;
+	while (r)
+	{
+		size += sizeof(t_redir);
+		r = r->next;
+	}
+	return (size);
+}
+
+/*
+** Bytes pcache_copy() lays the tree out in. Every piece is a struct
+** holding pointers or an array of them, so packing them back to back
+** keeps each one aligned.
+*/
+size_t	pcache_tree_size(t_pipeline *pl)
+{
+	size_t	size;
+	t_cmd	*cmd;
+
+	size = 0;
+	while (pl)
+	{
+		size += sizeof(t_pipeline);
+		cmd = pl->cmds;
+		while (cmd)
+		{
+			size += cmd_size(cmd);
+			cmd = cmd->next;
+		}
+		pl = pl->next;
+	}
+	return (size);
+}
+
+/*
+** One block: the entry, the three mask sets, the tree, then the key
+** and the parsed buffer.
+*/
+static t_pcent	*ent_new(size_t len, size_t tsize)
+{
+	t_pcent	*e;
+	size_t	words;
+
+	words = len / 64 + 1;
+	e = malloc(sizeof(t_pcent) + 3 * words * sizeof(uint64_t) + tsize
+			+ 2 * (len + 1));
+	if (!e)
+		return (NULL);
+	e->len = len;
+	e->tree_size = tsize;
+	e->stop = (uint64_t *)(e + 1);
+	e->dol = e->stop + words;
+	e->drop = e->dol + words;
+	e->key = (char *)(e->drop + words) + tsize;
+	e->image = e->key + len + 1;
+	return (e);
+}
+
+/*
+** Remember the tree just parsed from ln. key is the line's text from
+** before the parser terminated the words in ln->buf.
+*/
+void	pcache_store(t_pcache *pc, const char *key, t_line *ln,
+		t_pipeline *tree)
+{
+	t_pcent	*e;
+	size_t	bytes;
+
+	e = ent_new(ln->len, pcache_tree_size(tree));
+	if (!e)
+		return ;
+	bytes = (ln->len / 64 + 1) * sizeof(uint64_t);
+	ft_memcpy(e->stop, ln->qm.stop, bytes);
+	ft_memcpy(e->dol, ln->qm.dol, bytes);
+	ft_memcpy(e->drop, ln->qm.drop, bytes);
+	ft_memcpy(e->key, key, ln->len + 1);
+	ft_memcpy(e->image, ln->buf, ln->len + 1);
+	e->tree = pcache_copy(tree, (char *)(e->drop + ln->len / 64 + 1),
+			ln->buf, e->image);
+	e->hash = pc->hash;
+	pcache_insert(pc, e);
+}
+
+/* FNV-1a over the line's bytes */
+uint64_t	pcache_hash(const char *s, size_t len)
+{
+	uint64_t	h;
+	size_t		i;
+
+	h = 14695981039346656037ULL;
+	i = 0;
+	while (i < len)
+		h = (h ^ (unsigned char)s[i++]) * 1099511628211ULL;
+	return (h);
+}
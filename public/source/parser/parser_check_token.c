@@ -6,25 +6,25 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/12 12:32:12 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/12 13:52:15 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 11:58:40 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 
-int	is_valid_word(t_token *token)
+int	is_valid_word(t_tok *token)
 {
 	return (token && token->type == TOKEN_WORD);
 }
 
-int	is_control_operator(t_token *token)
+int	is_control_operator(t_tok *token)
 {
 	return (token && (token->type == TOKEN_PIPE
 			|| token->type == TOKEN_AND
 			|| token->type == TOKEN_OR));
 }
 
-int	is_redirection(t_token *token)
+int	is_redirection(t_tok *token)
 {
 	return (token && (token->type == TOKEN_REDIR_IN
 			|| token->type == TOKEN_REDIR_OUT
@@ -32,12 +32,12 @@ int	is_redirection(t_token *token)
 			|| token->type == TOKEN_REDIR_HEREDOC));
 }
 
-int	is_gt(t_token *t)
+int	is_gt(t_tok *t)
 {
 	return (t && (t->type == TOKEN_REDIR_OUT || t->type == TOKEN_REDIR_APPEND));
 }
 
-int	is_lt(t_token *t)
+int	is_lt(t_tok *t)
 {
 	return (t && (t->type == TOKEN_REDIR_IN || t->type == TOKEN_REDIR_HEREDOC));
 }
@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/12 15:05:53 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/12 15:06:32 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 11:58:40 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,7 +19,7 @@ void	print_unexpected(char *s)
 	ft_putendl_fd("'", 2);
 }
 
-int	tok_op_len(t_token *t)
+int	tok_op_len(t_tok *t)
 {
 	if (!t)
 		return (0);
@@ -30,17 +30,17 @@ int	tok_op_len(t_token *t)
 	return (0);
 }
 
-static void	handle_lt_run(t_token *t)
+static void	handle_lt_run(t_tok *t)
 {
 	int			total;
-	t_token		*cur;
+	t_tok		*cur;
 
 	total = 0;
 	cur = t;
 	while (is_lt(cur))
 	{
 		total += tok_op_len(cur);
-		cur = cur->next;
+		cur++;
 	}
 	if (total <= 3)
 		return (print_unexpected("newline"));
@@ -51,10 +51,10 @@ static void	handle_lt_run(t_token *t)
 	return (print_unexpected("<<<"));
 }
 
-void	print_run_error(t_token *t)
+void	print_run_error(t_tok *t)
 {
 	int			total;
-	t_token		*cur;
+	t_tok		*cur;
 
 	total = 0;
 	cur = t;
@@ -63,11 +63,12 @@ void	print_run_error(t_token *t)
 		while (is_gt(cur))
 		{
 			total += tok_op_len(cur);
-			cur = cur->next;
+			cur++;
 		}
 		if (total > 3)
 			ft_putendl_fd(ERR_REDIR_APPEND, 2);
-		else if (total == 2 && (!cur || is_control_operator(cur)
+		else if (total == 2 && (cur->type == TOKEN_EOF
+				|| is_control_operator(cur)
 				|| is_redirection(cur)))
 			ft_putendl_fd(ERR_NEWLINE, 2);
 		else
@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/05 16:18:14 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 16:31:08 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,7 +19,7 @@ static t_pipeline	*create_pipeline(void)
 {
 	t_pipeline	*pipeline;
 
-	pipeline = malloc(sizeof(t_pipeline));
+	pipeline = arena_alloc(&g_shell.arena, sizeof(t_pipeline));
 	if (!pipeline)
 		return (NULL);
 	pipeline->cmds = NULL;
@@ -30,89 +30,95 @@ static t_pipeline	*create_pipeline(void)
 
 /*
 ** Parse commands separated by pipes
-** Builds a linked list of commands in a single pipeline
+** Builds a linked list of commands in a single pipeline; tail is the
+** next field the following stage is linked into. Every stage, the
+** first one too, has to be a command, so "| a" and "a | | b" stop here.
 */
-t_cmd	*parse_pipe_sequence(t_token **tokens)
+t_cmd	*parse_pipe_sequence(t_parser *p)
 {
 	t_cmd	*cmds;
-	t_cmd	*new_cmd;
-	t_cmd	*current;
+	t_cmd	**tail;
 
 	cmds = NULL;
-	while (*tokens && (*tokens)->type != TOKEN_AND
-		&& (*tokens)->type != TOKEN_OR
-		&& (*tokens)->type != TOKEN_SEMICOLON)
+	tail = &cmds;
+	while (1)
 	{
-		new_cmd = parse_command(tokens);
-		if (!cmds)
-			cmds = new_cmd;
-		else
-		{
-			current = cmds;
-			while (current->next)
-				current = current->next;
-			current->next = new_cmd;
-		}
-		if (*tokens && (*tokens)->type == TOKEN_PIPE)
-			*tokens = (*tokens)->next;
-		else
-			break ;
+		*tail = parse_command(p);
+		if (!*tail)
+			return (NULL);
+		tail = &(*tail)->next;
+		if (p->tok->type != TOKEN_PIPE)
+			return (cmds);
+		p->tok++;
 	}
-	return (cmds);
 }
 
-/* helpers */
-static void	append_pipeline(t_pipeline **head, t_pipeline *new_node)
+/*
+** Take the operator that ends a pipeline. A line may not end in one,
+** and ';' may not be followed by a redirection; a separator after it
+** is caught by the next parse_command().
+*/
+int	set_logic_and_advance(t_pipeline *pl, t_parser *p)
 {
-	t_pipeline	*cur;
+	t_tok	*op;
 
-	if (!new_node)
-		return ;
-	if (!*head)
-	{
-		*head = new_node;
-		return ;
-	}
-	cur = *head;
-	while (cur->next)
-		cur = cur->next;
-	cur->next = new_node;
+	op = p->tok;
+	if (op->type != TOKEN_AND && op->type != TOKEN_OR
+		&& op->type != TOKEN_SEMICOLON)
+		return (1);
+	pl->logic_op = op->type;
+	p->tok++;
+	if (op->type == TOKEN_SEMICOLON && p->tok->type == TOKEN_EOF)
+		syntax_at(p, op);
+	else if (op->type == TOKEN_SEMICOLON && is_redirection(p->tok))
+		syntax_at(p, p->tok);
+	else if (p->tok->type == TOKEN_EOF)
+		syntax_at(p, p->tok);
+	return (p->err == NULL);
 }
 
-/* helpers */
-void	set_logic_and_advance(t_pipeline *pl, t_token **tokens)
+/*
+** Report the first token found out of place, with the message bash
+** gives for it, and hand its byte offset to the caller.
+*/
+static t_pipeline	*syntax_fail(t_parser *p, long *err_off)
 {
-	if (!tokens || !*tokens)
-		return ;
-	if ((*tokens)->type == TOKEN_AND
-		|| (*tokens)->type == TOKEN_OR
-		|| (*tokens)->type == TOKEN_SEMICOLON)
-	{
-		pl->logic_op = (*tokens)->type;
-		*tokens = (*tokens)->next;
-	}
+	print_syntax_error(p->err);
+	g_shell.exit_status = 258;
+	*err_off = (long)p->err->off;
+	return (NULL);
 }
 
-t_pipeline	*parser(t_token *tokens)
+/*
+** One pass over the tokens builds the lists and checks the syntax.
+** Returns NULL on a syntax error (reported, *err_off set) or when the
+** arena runs out (*err_off stays -1).
+*/
+t_pipeline	*parser(t_tokvec *tv, long *err_off)
 {
 	t_pipeline	*head;
-	t_pipeline	*node;
+	t_pipeline	**tail;
+	t_parser	p;
 
 	head = NULL;
-	while (tokens)
+	tail = &head;
+	p.tok = tv->data;
+	p.line = tv->line;
+	p.err = NULL;
+	*err_off = -1;
+	while (p.tok->type != TOKEN_EOF)
 	{
-		while (tokens && tokens->type == TOKEN_SEMICOLON)
-			tokens = tokens->next;
-		if (!tokens || tokens->type == TOKEN_EOF)
-			break ;
-		node = create_pipeline();
-		node->cmds = parse_pipe_sequence(&tokens);
-		set_logic_and_advance(node, &tokens);
-		append_pipeline(&head, node);
-		if (!tokens || tokens->type == TOKEN_EOF)
+		*tail = create_pipeline();
+		if (!*tail)
+			return (NULL);
+		(*tail)->cmds = parse_pipe_sequence(&p);
+		if (!(*tail)->cmds || !set_logic_and_advance(*tail, &p))
 			break ;
-		if (tokens->type == TOKEN_SEMICOLON)
-			tokens = tokens->next;
+		tail = &(*tail)->next;
 	}
+	if (p.err)
+		return (syntax_fail(&p, err_off));
+	if (*tail && !(*tail)->cmds)
+		return (NULL);
 	return (head);
 }
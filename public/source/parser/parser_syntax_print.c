@@ -6,13 +6,13 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/13 10:45:12 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/18 12:20:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
 /* First function: Handle simple token type errors */
-static void	print_token_type_error(t_token *token)
+static void	print_token_type_error(t_tok *token)
 {
 	if (token->type == TOKEN_PIPE)
 		ft_putendl_fd(ERR_PIPE, 2);
@@ -33,21 +33,36 @@ static void	print_token_type_error(t_token *token)
 }
 
 /* Second function: Handle special logic cases */
-static void	handle_special_error_cases(t_token *token)
+static void	handle_special_error_cases(t_tok *token)
 {
-	if (!token)
+	if (!token || token->type == TOKEN_EOF)
 	{
 		print_unexpected("newline");
 		return ;
 	}
-	if (is_redirection(token) && token->next && is_redirection(token->next))
+	if (is_redirection(token) && is_redirection(token + 1))
 		print_run_error(token);
 	else
 		print_token_type_error(token);
 }
 
 /* Main function */
-void	print_syntax_error(t_token *token)
+void	print_syntax_error(t_tok *token)
 {
 	handle_special_error_cases(token);
 }
+
+/*
+** Where the line stops making sense: the byte offset of the offending
+** token, which the parser already has, so nothing is scanned to find
+** it. Only for a terminal and a single physical line: after a
+** continuation the offsets no longer match what is on screen.
+*/
+void	print_syntax_offset(t_line *ln, long off)
+{
+	if (!g_shell.interactive || ln->joined || off < 0)
+		return ;
+	ft_putstr_fd("minishell: syntax error at byte ", 2);
+	ft_putnbr_fd((int)off, 2);
+	ft_putendl_fd(" of the line", 2);
+}
@@ -6,7 +6,7 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/12 14:00:49 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/17 23:40:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,56 +16,23 @@ t_redir	*create_redir(t_token_type type, char *file)
 {
 	t_redir	*redir;
 
-	redir = malloc(sizeof(t_redir));
+	redir = arena_alloc(&g_shell.arena, sizeof(t_redir));
 	if (!redir)
 		return (NULL);
 	redir->type = type;
-	redir->file = ft_strdup(file);
+	redir->file = file;
+	redir->fd = -1;
+	redir->expand = 0;
 	redir->next = NULL;
 	return (redir);
 }
 
-void	append_redir(t_redir **head, t_redir *new_redir)
+/*
+** Materialize a word span: terminate it in place inside the line.
+** The byte overwritten is a separator whose token is already recorded.
+*/
+char	*tok_word(t_parser *p, t_tok *t)
 {
-	t_redir	*current;
-
-	if (!new_redir)
-		return ;
-	if (!*head)
-	{
-		*head = new_redir;
-		return ;
-	}
-	current = *head;
-	while (current->next)
-		current = current->next;
-	current->next = new_redir;
-}
-
-void	free_pipeline(t_pipeline *pipeline)
-{
-	t_pipeline	*tmp_pipe;
-	t_cmd		*tmp_cmd;
-	t_redir		*tmp_redir;
-
-	while (pipeline)
-	{
-		tmp_pipe = pipeline;
-		while (pipeline->cmds)
-		{
-			tmp_cmd = pipeline->cmds;
-			free_array(tmp_cmd->args);
-			while (tmp_cmd->redirs)
-			{
-				tmp_redir = tmp_cmd->redirs;
-				tmp_cmd->redirs = tmp_redir->next;
-				free(tmp_redir->file);
-				free(tmp_redir);
-			}
-			pipeline->cmds = tmp_cmd->next;
-			free(tmp_cmd);
-		}
-		pipeline = pipeline->next;
-		free(tmp_pipe);
-	}
+	p->line[t->off + t->len] = '\0';
+	return (p->line + t->off);
 }
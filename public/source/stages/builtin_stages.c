@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_stages.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:05:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 10:15:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/* seconds, to the millisecond */
+static void	put_secs(long us)
+{
+	long	ms;
+
+	ft_putnbr_fd((int)(us / 1000000), 1);
+	ft_putchar_fd('.', 1);
+	ms = us / 1000 % 1000;
+	if (ms < 100)
+		ft_putchar_fd('0', 1);
+	if (ms < 10)
+		ft_putchar_fd('0', 1);
+	ft_putnbr_fd((int)ms, 1);
+}
+
+static void	put_stage(int i, t_stage *st)
+{
+	ft_putnbr_fd(i, 1);
+	ft_putchar_fd('\t', 1);
+	ft_putnbr_fd(st->pid, 1);
+	ft_putchar_fd('\t', 1);
+	ft_putnbr_fd(st->status, 1);
+	ft_putchar_fd('\t', 1);
+	put_secs(st->real);
+	ft_putchar_fd('\t', 1);
+	put_secs(st->user);
+	ft_putchar_fd('\t', 1);
+	put_secs(st->sys);
+	ft_putchar_fd('\n', 1);
+}
+
+/*
+** stages: one line per stage of the last pipeline before this one,
+** with its pid (0 when the shell ran it), its status and its real,
+** user and sys times in seconds. A builtin, so it shadows any stages
+** program in PATH; a path such as /usr/bin/stages still runs that.
+*/
+int	builtin_stages(char **args, t_shell *shell)
+{
+	int	i;
+
+	if (args[1])
+	{
+		print_error("stages", "usage: stages");
+		return (2);
+	}
+	ft_putendl_fd("stage\tpid\tstatus\treal\tuser\tsys", 1);
+	i = 0;
+	while (i < shell->stages.n)
+	{
+		put_stage(i, &shell->stages.v[i]);
+		i++;
+	}
+	return (0);
+}
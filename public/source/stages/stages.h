@@ -0,0 +1,57 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stages.h                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:05:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 10:15:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef STAGES_H
+# define STAGES_H
+
+# include <sys/types.h>
+
+/*
+** The stages of the last pipeline, for $PIPESTATUS, set -o pipefail and
+** the stages builtin. op_wait() reaps the children in the order they
+** end, with wait4(), which hands back the rusage of each one with its
+** status. real is the wall time from its start to its reap, user and
+** sys the CPU time it used, all in microseconds; start is when the
+** shell started it, on the stage_clock().
+**
+** A pipeline that started no process (a builtin the shell ran itself,
+** a program that was not found) is kept as one stage with pid 0 and $?
+** for its status.
+**
+** Both names are taken from the user: $PIPESTATUS always expands to
+** these statuses, whatever PIPESTATUS the environment holds, and the
+** stages builtin is found before any stages program in PATH.
+*/
+typedef struct s_stage
+{
+	pid_t	pid;
+	int		status;
+	long	start;
+	long	real;
+	long	user;
+	long	sys;
+}	t_stage;
+
+typedef struct s_stages
+{
+	t_stage	*v;
+	int		n;
+	int		cap;
+}	t_stages;
+
+long	stage_clock(void);
+void	stages_reap(t_stage *v, int n);
+int		stages_status(t_stage *v, int n, int pipefail);
+void	stages_keep(t_stages *s, t_stage *v, int n, int status);
+void	stages_destroy(t_stages *s);
+
+#endif
@@ -0,0 +1,62 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stages_keep.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:05:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 01:05:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static int	stages_reserve(t_stages *s, int n)
+{
+	t_stage	*v;
+	int		cap;
+
+	if (n <= s->cap)
+		return (0);
+	cap = 8;
+	while (cap < n)
+		cap *= 2;
+	v = malloc(sizeof(t_stage) * cap);
+	if (!v)
+		return (-1);
+	free(s->v);
+	s->v = v;
+	s->cap = cap;
+	return (0);
+}
+
+/*
+** Keep the stages of the pipeline that just ran, n of them in v; with
+** none, it started no process and status is its $?.
+*/
+void	stages_keep(t_stages *s, t_stage *v, int n, int status)
+{
+	if (stages_reserve(s, n + (n == 0)) == -1)
+	{
+		s->n = 0;
+		return ;
+	}
+	if (n == 0)
+	{
+		ft_bzero(s->v, sizeof(t_stage));
+		s->v[0].status = status;
+		s->n = 1;
+		return ;
+	}
+	ft_memcpy(s->v, v, sizeof(t_stage) * n);
+	s->n = n;
+}
+
+void	stages_destroy(t_stages *s)
+{
+	free(s->v);
+	s->v = NULL;
+	s->n = 0;
+	s->cap = 0;
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stages_reap.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 01:05:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 01:05:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+#include <sys/resource.h>
+#include <time.h>
+
+/* microseconds on the monotonic clock */
+long	stage_clock(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec * 1000000L + ts.tv_nsec / 1000);
+}
+
+static void	stage_done(t_stage *st, int status, struct rusage *ru)
+{
+	if (WIFSIGNALED(status))
+		st->status = 128 + WTERMSIG(status);
+	else
+		st->status = WEXITSTATUS(status);
+	st->real = stage_clock() - st->start;
+	st->user = ru->ru_utime.tv_sec * 1000000L + ru->ru_utime.tv_usec;
+	st->sys = ru->ru_stime.tv_sec * 1000000L + ru->ru_stime.tv_usec;
+}
+
+/* the stage that is pid; -1 for a child that is none of them */
+static int	stage_of(t_stage *v, int n, pid_t pid)
+{
+	while (n-- > 0)
+	{
+		if (v[n].pid == pid)
+			return (n);
+	}
+	return (-1);
+}
+
+/*
+** Reap every started stage as it ends rather than in pipeline order,
+** so a slow first stage holds up nothing. A stage that never started
+** (its fork failed) keeps status 0; op_wait() makes $? 1 for that.
+*/
+void	stages_reap(t_stage *v, int n)
+{
+	struct rusage	ru;
+	int				status;
+	int				left;
+	int				i;
+	pid_t			pid;
+
+	left = 0;
+	i = n;
+	while (i-- > 0)
+		left += v[i].pid > 0;
+	while (left > 0)
+	{
+		pid = wait4(-1, &status, 0, &ru);
+		if (pid == -1 && errno == EINTR)
+			continue ;
+		if (pid == -1)
+		{
+			print_error("wait4", strerror(errno));
+			break ;
+		}
+		i = stage_of(v, n, pid);
+		if (i >= 0)
+			stage_done(&v[i], status, &ru);
+		left -= i >= 0;
+	}
+}
+
+/*
+** $? of the pipeline: its last stage's status or, with pipefail, the
+** status of the last stage that failed, 0 if none did.
+*/
+int	stages_status(t_stage *v, int n, int pipefail)
+{
+	int	i;
+
+	if (n <= 0)
+		return (0);
+	if (!pipefail)
+		return (v[n - 1].status);
+	i = n;
+	while (i-- > 0)
+	{
+		if (v[i].status != 0)
+			return (v[i].status);
+	}
+	return (0);
+}
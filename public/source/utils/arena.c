@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+/* pop a recycled chunk big enough for size, or malloc a fresh one */
+static t_chunk	*take_chunk(t_arena *a, size_t size)
+{
+	t_chunk	*c;
+	t_chunk	**link;
+
+	link = &a->spare;
+	while (*link && (*link)->size < size)
+		link = &(*link)->next;
+	c = *link;
+	if (c)
+		*link = c->next;
+	else
+	{
+		if (size < ARENA_CHUNK)
+			size = ARENA_CHUNK;
+		c = malloc(ARENA_HDR + size);
+		if (!c)
+			return (NULL);
+		c->size = size;
+	}
+	c->used = 0;
+	c->next = a->head;
+	a->head = c;
+	return (c);
+}
+
+void	*arena_alloc(t_arena *a, size_t size)
+{
+	void	*p;
+
+	size = (size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+	if (!a->head || a->head->used + size > a->head->size)
+	{
+		if (!take_chunk(a, size))
+			return (NULL);
+	}
+	p = (char *)a->head + ARENA_HDR + a->head->used;
+	a->head->used += size;
+	a->total += size;
+	a->allocs++;
+	if (a->total > a->peak)
+		a->peak = a->total;
+	return (p);
+}
+
+/* keep at most ARENA_KEEP bytes of spare chunks around for the next line */
+static void	trim_spare(t_arena *a)
+{
+	t_chunk	**link;
+	t_chunk	*c;
+	size_t	kept;
+
+	kept = 0;
+	link = &a->spare;
+	while (*link)
+	{
+		c = *link;
+		if (kept + c->size <= ARENA_KEEP)
+		{
+			kept += c->size;
+			link = &c->next;
+			continue ;
+		}
+		*link = c->next;
+		free(c);
+	}
+}
+
+void	arena_reset(t_arena *a)
+{
+	t_chunk	*c;
+
+	if (ARENA_DEBUG && a->peak)
+	{
+		ft_putstr_fd("minishell: arena: peak ", 2);
+		ft_putnbr_fd((int)a->peak, 2);
+		ft_putstr_fd(" bytes, ", 2);
+		ft_putnbr_fd((int)a->allocs, 2);
+		ft_putendl_fd(" allocations", 2);
+	}
+	while (a->head)
+	{
+		c = a->head;
+		a->head = c->next;
+		if (ARENA_DEBUG)
+			ft_memset((char *)c + ARENA_HDR, ARENA_POISON, c->used);
+		c->next = a->spare;
+		a->spare = c;
+	}
+	trim_spare(a);
+	a->total = 0;
+	a->peak = 0;
+	a->allocs = 0;
+}
+
+void	arena_destroy(t_arena *a)
+{
+	t_chunk	*c;
+
+	arena_reset(a);
+	while (a->spare)
+	{
+		c = a->spare;
+		a->spare = c->next;
+		free(c);
+	}
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/18 12:00:00 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef ARENA_H
+# define ARENA_H
+
+# include <stddef.h>
+
+/*
+** Line-scoped bump allocator.
+** Everything the lexer, parser and expander build for one input line is
+** carved out of g_shell.arena and released at once by arena_reset() at the
+** end of process_line(). Chunks are recycled between lines (up to
+** ARENA_KEEP bytes) so a steady stream of lines does not touch malloc.
+**
+** allocs counts the blocks arena_alloc() handed out since the last
+** reset (a block grown in place is not a new one); bench/expand_allocs.c
+** reads it. Build with -D ARENA_DEBUG=1 to poison released memory and
+** to print the peak number of arena bytes and the allocations of every
+** line.
+*/
+
+# ifndef ARENA_DEBUG
+#  define ARENA_DEBUG 0
+# endif
+
+# define ARENA_CHUNK	65536
+# define ARENA_KEEP		1048576
+# define ARENA_ALIGN	16
+# define ARENA_HDR		32
+# define ARENA_POISON	0xA5
+
+typedef struct s_chunk
+{
+	struct s_chunk	*next;
+	size_t			size;
+	size_t			used;
+}	t_chunk;
+
+typedef struct s_arena
+{
+	t_chunk	*head;
+	t_chunk	*spare;
+	size_t	total;
+	size_t	peak;
+	size_t	allocs;
+}	t_arena;
+
+typedef struct s_arena_mark
+{
+	t_chunk	*chunk;
+	size_t	used;
+	size_t	total;
+}	t_arena_mark;
+
+void			*arena_alloc(t_arena *a, size_t size);
+void			arena_reset(t_arena *a);
+void			arena_destroy(t_arena *a);
+char			*arena_strndup(t_arena *a, const char *s, size_t n);
+char			*arena_strdup(t_arena *a, const char *s);
+t_arena_mark	arena_mark(t_arena *a);
+void			arena_release(t_arena *a, t_arena_mark m);
+void			arena_shrink(t_arena *a, void *p, size_t size);
+void			*arena_grow(t_arena *a, void *p, size_t old, size_t size);
+
+#endif
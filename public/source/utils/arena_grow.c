@@ -0,0 +1,61 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_grow.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 11:58:40 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+static size_t	arena_align(size_t size)
+{
+	return ((size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1));
+}
+
+/* p is the last block handed out and the current chunk has room for size */
+static int	can_grow_in_place(t_arena *a, char *p, size_t old, size_t size)
+{
+	char	*base;
+	size_t	off;
+
+	if (!p || !a->head)
+		return (0);
+	base = (char *)a->head + ARENA_HDR;
+	if (p < base || p >= base + a->head->used)
+		return (0);
+	off = p - base;
+	if (off + arena_align(old) != a->head->used)
+		return (0);
+	return (off + arena_align(size) <= a->head->size);
+}
+
+/*
+** arena_grow - resize the most recent allocation
+** Extends the block in place when it is still on top of the current chunk
+** (the common case for vectors filled in a tight loop), otherwise moves it
+** to a fresh block. The old block is reclaimed with the rest of the line.
+*/
+void	*arena_grow(t_arena *a, void *p, size_t old, size_t size)
+{
+	void	*np;
+	size_t	delta;
+
+	if (can_grow_in_place(a, p, old, size))
+	{
+		delta = arena_align(size) - arena_align(old);
+		a->head->used += delta;
+		a->total += delta;
+		if (a->total > a->peak)
+			a->peak = a->total;
+		return (p);
+	}
+	np = arena_alloc(a, size);
+	if (np && p)
+		ft_memcpy(np, p, old);
+	return (np);
+}
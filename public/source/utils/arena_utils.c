@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/17 10:00:00 by malmarzo          #+#    #+#             */
+/*   Updated: 2026/10/17 10:41:12 by malmarzo         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../minishell.h"
+
+char	*arena_strndup(t_arena *a, const char *s, size_t n)
+{
+	char	*d;
+
+	d = arena_alloc(a, n + 1);
+	if (!d)
+		return (NULL);
+	ft_memcpy(d, s, n);
+	d[n] = '\0';
+	return (d);
+}
+
+char	*arena_strdup(t_arena *a, const char *s)
+{
+	if (!s)
+		return (NULL);
+	return (arena_strndup(a, s, ft_strlen(s)));
+}
+
+/*
+** arena_mark / arena_release - scoped scratch space
+** Everything allocated after the mark is handed back by the release,
+** e.g. one expanded heredoc line at a time.
+*/
+t_arena_mark	arena_mark(t_arena *a)
+{
+	t_arena_mark	m;
+
+	m.chunk = a->head;
+	m.used = 0;
+	if (a->head)
+		m.used = a->head->used;
+	m.total = a->total;
+	return (m);
+}
+
+void	arena_release(t_arena *a, t_arena_mark m)
+{
+	t_chunk	*c;
+
+	while (a->head && a->head != m.chunk)
+	{
+		c = a->head;
+		a->head = c->next;
+		if (ARENA_DEBUG)
+			ft_memset((char *)c + ARENA_HDR, ARENA_POISON, c->used);
+		c->next = a->spare;
+		a->spare = c;
+	}
+	if (a->head)
+	{
+		if (ARENA_DEBUG)
+			ft_memset((char *)a->head + ARENA_HDR + m.used, ARENA_POISON,
+				a->head->used - m.used);
+		a->head->used = m.used;
+	}
+	a->total = m.total;
+}
+
+/*
+** Give back the unused tail of the most recent allocation.
+** Only valid for the last block handed out by arena_alloc().
+*/
+void	arena_shrink(t_arena *a, void *p, size_t size)
+{
+	char	*base;
+	size_t	off;
+
+	if (!a->head || !p)
+		return ;
+	base = (char *)a->head + ARENA_HDR;
+	if ((char *)p < base || (char *)p >= base + a->head->used)
+		return ;
+	off = (char *)p - base;
+	size = (size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+	if (off + size >= a->head->used)
+		return ;
+	a->total -= a->head->used - (off + size);
+	a->head->used = off + size;
+}
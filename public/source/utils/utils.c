@@ -6,30 +6,11 @@
 /*   By: malmarzo <malmarzo@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/11/02 09:15:37 by malmarzo          #+#    #+#             */
-/*   Updated: 2025/11/06 15:06:08 by malmarzo         ###   ########.fr       */
+/*   Updated: 2026/10/18 12:40:00 by malmarzo         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "../../minishell.h"
-/*
-** Free array of strings
-** Frees each string and the array itself
-*/
-void	free_array(char **arr)
-{
-	int	i;
-
-	if (!arr)
-		return ;
-	i = 0;
-	while (arr[i])
-	{
-		free(arr[i]);
-		i++;
-	}
-	free(arr);
-}
-
 /*
 ** Join two strings and free the first one
 ** Useful for chaining multiple joins
@@ -59,20 +40,25 @@ char	*ft_strjoin_free(char *s1, char const *s2)
 
 /*
 ** Free all environment variables
-** Frees keys, values, and nodes
+** Frees the variables, their values, the index and envp
 */
 void	free_env(t_env *env)
 {
-	t_env	*tmp;
+	t_var	*var;
+	t_var	*tmp;
 
-	while (env)
+	if (!env)
+		return ;
+	var = env->head;
+	while (var)
 	{
-		tmp = env;
-		env = env->next;
-		free(tmp->key);
-		free(tmp->value);
-		free(tmp);
+		tmp = var;
+		var = var->next;
+		env_free_var(tmp);
 	}
+	free(env->slots);
+	free(env->envp);
+	free(env);
 }
 
 int	is_valid_identifier(char *s)